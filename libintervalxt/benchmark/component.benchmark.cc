@@ -0,0 +1,61 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "../intervalxt/component.hpp"
+#include "../intervalxt/dynamical_decomposition.hpp"
+#include "../intervalxt/half_edge.hpp"
+#include "../intervalxt/interval_exchange_transformation.hpp"
+#include "../intervalxt/sample/integer_coefficients.hpp"
+#include "../intervalxt/sample/integer_floor_division.hpp"
+#include "../intervalxt/sample/lengths.hpp"
+
+using namespace intervalxt;
+
+namespace intervalxt::test {
+
+// Walk around the components of the decomposition of a rotation-like IET on
+// seven intervals, i.e., create lots of half edges, connections, and
+// separatrices.
+void Perimeter(benchmark::State& state) {
+  auto&& [lengths, a, b, c, d, e, f, g] = sample::Lengths<int>::make(977, 113, 5, 1, 17, 23, 1001);
+  auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), {a, b, c, d, e, f, g}, {g, f, e, d, c, b, a});
+  auto decomposition = DynamicalDecomposition(iet);
+  decomposition.decompose();
+
+  const auto components = decomposition.components();
+
+  size_t sides = 0;
+  for (auto _ : state) {
+    for (const auto& component : components) {
+      sides += component.perimeter().size();
+      for (const auto& halfEdge : component.topContour())
+        sides += halfEdge.cross().size();
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(sides));
+}
+BENCHMARK(Perimeter);
+
+}  // namespace intervalxt::test
@@ -0,0 +1,170 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "../intervalxt/label.hpp"
+#include "../src/impl/decomposition_state.hpp"
+#include "../src/impl/pooled_list.hpp"
+
+using namespace intervalxt;
+
+namespace intervalxt::test {
+
+namespace {
+
+using Connection = DecompositionState::Connection;
+
+// An allocator that counts the bytes it hands out.
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  explicit CountingAllocator(size_t& bytes) :
+    bytes(&bytes) {}
+
+  template <typename S>
+  CountingAllocator(const CountingAllocator<S>& other) :
+    bytes(other.bytes) {}
+
+  T* allocate(size_t n) {
+    *bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  bool operator==(const CountingAllocator& rhs) const { return bytes == rhs.bytes; }
+  bool operator!=(const CountingAllocator& rhs) const { return bytes != rhs.bytes; }
+
+  size_t* bytes;
+};
+
+// The connections at a label as they were stored before PooledList.
+struct ListConnections {
+  using List = std::list<Connection, CountingAllocator<Connection>>;
+
+  explicit ListConnections(size_t& bytes) :
+    topLeft(CountingAllocator<Connection>(bytes)),
+    topRight(CountingAllocator<Connection>(bytes)),
+    bottomLeft(CountingAllocator<Connection>(bytes)),
+    bottomRight(CountingAllocator<Connection>(bytes)) {}
+
+  List topLeft;
+  List topRight;
+  List bottomLeft;
+  List bottomRight;
+};
+
+// Populate the connections of range(0) labels with four connections per
+// label and move them around like a decomposition does.
+template <typename Store>
+void populate(Store& store, const std::vector<Label>& labels) {
+  for (size_t i = 0; i < labels.size(); i++) {
+    const Connection connection = {{labels[i], DecompositionState::Separatrix::Orientation::PARALLEL}, {labels[(i + 1) % labels.size()], DecompositionState::Separatrix::Orientation::ANTIPARALLEL}};
+    auto& connections = store.connections(labels[i]);
+    connections.topLeft.push_front(connection);
+    connections.topRight.push_back(connection);
+    connections.bottomLeft.push_front(connection);
+    connections.bottomRight.push_back(connection);
+  }
+
+  for (size_t i = 1; i < labels.size(); i++) {
+    auto& source = store.connections(labels[i - 1]);
+    auto& target = store.connections(labels[i]);
+    target.bottomLeft.splice(end(target.bottomLeft), source.topLeft);
+    target.bottomRight.splice(begin(target.bottomRight), source.bottomRight);
+  }
+}
+
+struct ListStore {
+  explicit ListStore(const std::vector<Label>& labels) {
+    for (const auto& label : labels)
+      connections_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple(bytes));
+  }
+
+  ListConnections& connections(const Label& label) { return connections_.at(label); }
+
+  size_t bytes = 0;
+  std::unordered_map<Label, ListConnections> connections_;
+};
+
+struct PooledStore {
+  explicit PooledStore(const std::vector<Label>& labels) {
+    for (const auto& label : labels)
+      state.insertConnections(label);
+  }
+
+  DecompositionState::Connections& connections(const Label& label) { return state.connections(label); }
+
+  DecompositionState state;
+};
+
+}  // namespace
+
+// Report the throughput of creating and splicing connections of
+// a decomposition with range(0) labels with std::list, and the bytes
+// allocated per connection (not counting the overhead of malloc.)
+void ListConnectionsInsert(benchmark::State& state) {
+  std::vector<Label> labels;
+  for (int i = 0; i < state.range(0); i++)
+    labels.push_back(Label(i));
+
+  size_t bytes = 0;
+  for (auto _ : state) {
+    ListStore store(labels);
+    populate(store, labels);
+    bytes = store.bytes;
+    benchmark::DoNotOptimize(store);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 4 * labels.size());
+  state.counters["bytes/connection"] = static_cast<double>(bytes) / static_cast<double>(4 * labels.size());
+}
+BENCHMARK(ListConnectionsInsert)->Arg(16)->Arg(1024);
+
+// Report the throughput of creating and splicing connections of
+// a decomposition with range(0) labels with PooledList, and the bytes
+// reserved by the pool per connection.
+void PooledConnectionsInsert(benchmark::State& state) {
+  std::vector<Label> labels;
+  for (int i = 0; i < state.range(0); i++)
+    labels.push_back(Label(i));
+
+  size_t bytes = 0;
+  for (auto _ : state) {
+    PooledStore store(labels);
+    populate(store, labels);
+    bytes = store.state.pool.memory();
+    benchmark::DoNotOptimize(store);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 4 * labels.size());
+  state.counters["bytes/connection"] = static_cast<double>(bytes) / static_cast<double>(4 * labels.size());
+}
+BENCHMARK(PooledConnectionsInsert)->Arg(16)->Arg(1024);
+
+}  // namespace intervalxt::test
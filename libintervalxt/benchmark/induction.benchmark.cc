@@ -20,23 +20,32 @@
 #include <benchmark/benchmark.h>
 
 #include <iostream>
+#include <vector>
 
+#include "../intervalxt/component.hpp"
+#include "../intervalxt/decomposition_step.hpp"
 #include "../intervalxt/dynamical_decomposition.hpp"
 #include "../intervalxt/interval_exchange_transformation.hpp"
 #include "../intervalxt/label.hpp"
 #include "../intervalxt/length.hpp"
+#include "../intervalxt/sample/checked_integer_coefficients.hpp"
+#include "../intervalxt/sample/checked_integer_floor_division.hpp"
+#include "../intervalxt/sample/coordinate_lengths.hpp"
 #include "../intervalxt/sample/integer_coefficients.hpp"
 #include "../intervalxt/sample/integer_floor_division.hpp"
 #include "../intervalxt/sample/lengths.hpp"
+#include "../intervalxt/sample/mpq_approximation.hpp"
+#include "../intervalxt/sample/mpq_coefficients.hpp"
+#include "../intervalxt/sample/mpq_floor_division.hpp"
+#include "../intervalxt/sample/mpz_coefficients.hpp"
+#include "../intervalxt/sample/mpz_floor_division.hpp"
 
 using namespace intervalxt;
 
 namespace intervalxt::test {
 
-template <class T>
+template <class T, class TLengths = sample::Lengths<T>>
 void Induction(benchmark::State& state) {
-  using TLengths = sample::Lengths<T>;
-
   const int LIMIT = static_cast<int>(state.range(0));
 
   for (auto _ : state) {
@@ -49,7 +58,7 @@ void Induction(benchmark::State& state) {
                 int g = LIMIT - a - b - c - d - e - f;
                 assert(g > 0);
 
-                auto&& [lengths, aa, bb, cc, dd, ee, ff, gg] = TLengths::make(a, b, c, d, e, f, g);
+                auto&& [lengths, aa, bb, cc, dd, ee, ff, gg] = TLengths::make(T(a), T(b), T(c), T(d), T(e), T(f), T(g));
 
                 auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), {aa, bb, cc, dd, ee, ff, gg}, {gg, ff, ee, dd, cc, bb, aa});
                 auto decomposition = DynamicalDecomposition(iet);
@@ -63,5 +72,82 @@ void Induction(benchmark::State& state) {
   }
 }
 BENCHMARK_TEMPLATE(Induction, int)->Arg(8)->Arg(34);
+BENCHMARK_TEMPLATE(Induction, sample::CheckedInteger)->Arg(8)->Arg(34);
+BENCHMARK_TEMPLATE(Induction, mpz_class)->Arg(8)->Arg(34);
+BENCHMARK_TEMPLATE(Induction, mpq_class)->Arg(8)->Arg(34);
+BENCHMARK_TEMPLATE(Induction, mpq_class, sample::CoordinateLengths<mpq_class>)->Arg(8)->Arg(34);
+
+// Decompose step by step like Induction but, depending on the second
+// argument, also compute the DecompositionStep::equivalent path of every
+// connection that is found.
+template <class T>
+void DecompositionSteps(benchmark::State& state) {
+  const int LIMIT = static_cast<int>(state.range(0));
+  const bool equivalent = state.range(1);
+
+  for (auto _ : state) {
+    for (int a = 1; a < LIMIT - 6; a++) {
+      for (int b = 1; b < LIMIT - a - 5; b++) {
+        for (int c = 1; c < LIMIT - a - b - 4; c++) {
+          for (int d = 1; d < LIMIT - a - b - c - 3; d++) {
+            for (int e = 1; e < LIMIT - a - b - c - d - 2; e++) {
+              for (int f = 1; f < LIMIT - a - b - c - d - e - 1; f++) {
+                int g = LIMIT - a - b - c - d - e - f;
+
+                auto&& [lengths, aa, bb, cc, dd, ee, ff, gg] = sample::Lengths<T>::make(T(a), T(b), T(c), T(d), T(e), T(f), T(g));
+
+                auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), {aa, bb, cc, dd, ee, ff, gg}, {gg, ff, ee, dd, cc, bb, aa});
+                auto decomposition = DynamicalDecomposition(iet);
+
+                auto components = decomposition.components();
+                while (!components.empty()) {
+                  auto component = components.back();
+                  components.pop_back();
+                  while (!((component.cylinder() || component.withoutPeriodicTrajectory()) ? true : false)) {
+                    auto step = component.decompositionStep(-1, equivalent);
+                    benchmark::DoNotOptimize(step.equivalent);
+                    if (step.additionalComponent)
+                      components.push_back(*step.additionalComponent);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+BENCHMARK_TEMPLATE(DecompositionSteps, int)->Args({34, false})->Args({34, true});
+
+// Decompose an IET that splits into many components, i.e., a sequence of
+// blocks of rotation-like IETs, on a varying number of threads.
+void ParallelDecomposition(benchmark::State& state) {
+  const int BLOCKS = static_cast<int>(state.range(0));
+  const auto threads = static_cast<unsigned int>(state.range(1));
+  constexpr int SIZE = 7;
+
+  std::vector<mpz_class> values;
+  mpz_class value = 1;
+  for (int i = 0; i < BLOCKS * SIZE; i++) {
+    value = (value * 1103515245 + 12345) % (mpz_class(1) << 256);
+    values.push_back(value + 1);
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    sample::Lengths<mpz_class> lengths(values);
+    const auto top = lengths.labels();
+    std::vector<Label> bottom;
+    for (int block = 0; block < BLOCKS; block++)
+      for (int i = SIZE - 1; i >= 0; i--)
+        bottom.push_back(top[block * SIZE + i]);
+    auto decomposition = DynamicalDecomposition(IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), top, bottom));
+    state.ResumeTiming();
+
+    decomposition.decompose([](const auto& c) { return (c.cylinder() || c.withoutPeriodicTrajectory()) ? true : false; }, -1, threads);
+  }
+}
+BENCHMARK(ParallelDecomposition)->Args({32, 1})->Args({32, 2})->Args({32, 4})->Args({32, 8})->UseRealTime();
 
 }  // namespace intervalxt::test
@@ -0,0 +1,107 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <gmp.h>
+#include <gmpxx.h>
+
+#include <memory>
+#include <vector>
+
+#include "../intervalxt/interval_exchange_transformation.hpp"
+#include "../intervalxt/label.hpp"
+#include "../intervalxt/sample/lengths.hpp"
+#include "../intervalxt/sample/mpq_approximation.hpp"
+#include "../intervalxt/sample/mpq_coefficients.hpp"
+#include "../intervalxt/sample/mpq_floor_division.hpp"
+#include "../intervalxt/sample/mpz_approximation.hpp"
+#include "../intervalxt/sample/mpz_coefficients.hpp"
+#include "../intervalxt/sample/mpz_floor_division.hpp"
+
+using namespace intervalxt;
+
+namespace intervalxt::test {
+
+namespace {
+
+// Counts the allocations that GMP performs while it is alive.
+class CountGmpAllocations {
+ public:
+  CountGmpAllocations() {
+    mp_get_memory_functions(&allocate, &reallocate, &free);
+    count = 0;
+    mp_set_memory_functions(
+        [](size_t size) { count++; return allocate(size); },
+        [](void* ptr, size_t old, size_t size) { count++; return reallocate(ptr, old, size); },
+        free);
+  }
+
+  ~CountGmpAllocations() {
+    mp_set_memory_functions(allocate, reallocate, free);
+  }
+
+  size_t allocations() const { return count; }
+
+ private:
+  static inline void* (*allocate)(size_t);
+  static inline void* (*reallocate)(void*, size_t, size_t);
+  static inline void (*free)(void*, size_t);
+  static inline size_t count;
+};
+
+}  // namespace
+
+// Report the number of allocations that GMP performs for a Zorich induction
+// step on generic lengths of size 2^range(0).
+template <class T>
+void ZorichInductionAllocations(benchmark::State& state) {
+  const auto bits = static_cast<mp_bitcnt_t>(state.range(0));
+
+  gmp_randclass random(gmp_randinit_default);
+  random.seed(1337);
+
+  size_t steps = 0;
+  size_t allocations = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::vector<T> values;
+    for (int i = 0; i < 7; i++)
+      values.push_back(T(random.get_z_bits(bits) + 1));
+
+    auto lengths = sample::Lengths<T>(values);
+    const auto labels = lengths.labels();
+    auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), labels, std::vector<Label>(labels.rbegin(), labels.rend()));
+    state.ResumeTiming();
+
+    CountGmpAllocations counter;
+    for (int i = 0; i < 64; i++) {
+      steps++;
+      if (iet.zorichInduction())
+        break;
+    }
+    allocations += counter.allocations();
+  }
+
+  state.counters["allocations/step"] = static_cast<double>(allocations) / static_cast<double>(steps);
+}
+BENCHMARK_TEMPLATE(ZorichInductionAllocations, mpz_class)->Arg(64)->Arg(1024);
+BENCHMARK_TEMPLATE(ZorichInductionAllocations, mpq_class)->Arg(64)->Arg(1024);
+
+}  // namespace intervalxt::test
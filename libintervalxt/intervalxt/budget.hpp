@@ -0,0 +1,88 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_BUDGET_HPP
+#define LIBINTERVALXT_BUDGET_HPP
+
+#include <boost/operators.hpp>
+#include <chrono>
+#include <iosfwd>
+#include <optional>
+
+#include "forward.hpp"
+#include "shared.hpp"
+
+namespace intervalxt {
+
+// Bounds the work spent in IntervalExchangeTransformation::induce(),
+// Component::decompositionStep(), Component::decompose(), and
+// DynamicalDecomposition::decompose(). Once a budget is exhausted, these
+// return at the next opportunity and report that their limit has been
+// reached.
+// The budget is checked before each step of Zorich induction and before
+// Boshernitzan's criterion is evaluated; a step that is already running is
+// never interrupted.
+// Copies of a budget share their state, i.e., steps spent through a copy are
+// spent for all copies and cancelling a copy cancels all of them.
+class LIBINTERVALXT_API Budget : boost::equality_comparable<Budget> {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  // Create a budget that is only exhausted when it is cancelled.
+  Budget();
+
+  // Create a budget that is exhausted at the deadline (if any) or after steps
+  // steps of induction (if any), where steps are counted like the limit of
+  // IntervalExchangeTransformation::induce().
+  explicit Budget(std::optional<Clock::time_point> deadline, std::optional<size_t> steps = std::nullopt);
+
+  // Create a budget that is exhausted once timeout has elapsed (or after
+  // steps steps of induction.)
+  explicit Budget(Clock::duration timeout, std::optional<size_t> steps = std::nullopt);
+
+  // Exhaust this budget and all its copies. This may be called from any
+  // thread, in particular while another thread is spending the budget.
+  void cancel();
+
+  // Return whether this budget (or one of its copies) has been cancelled.
+  bool cancelled() const;
+
+  // Return whether this budget has been cancelled, its deadline has passed,
+  // or all its steps have been spent.
+  bool exhausted() const;
+
+  // Return the deadline of this budget, if any.
+  std::optional<Clock::time_point> deadline() const;
+
+  // Return the number of steps that have not been spent yet, if limited.
+  std::optional<size_t> steps() const;
+
+  bool operator==(const Budget&) const;
+
+  LIBINTERVALXT_API friend std::ostream& operator<<(std::ostream&, const Budget&);
+
+ private:
+  Shared<Budget> self;
+
+  friend ImplementationOf<Budget>;
+};
+
+}  // namespace intervalxt
+
+#endif
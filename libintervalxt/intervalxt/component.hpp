@@ -24,8 +24,10 @@
 #include <boost/logic/tribool.hpp>
 #include <boost/operators.hpp>
 #include <functional>
+#include <iterator>
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "connection.hpp"
 #include "copyable.hpp"
@@ -44,11 +46,16 @@ class LIBINTERVALXT_API Component : boost::equality_comparable<Component> {
   boost::logic::tribool withoutPeriodicTrajectory() const;
   boost::logic::tribool keane() const;
 
+  class HalfEdges;
+  class Sides;
+
   // The half edges that make up the top contour, left to right.
   std::vector<HalfEdge> topContour() const;
+  HalfEdges topContourView() const;
 
   // The half edges that make up the bottom contour, left to right.
   std::vector<HalfEdge> bottomContour() const;
+  HalfEdges bottomContourView() const;
 
   HalfEdge topContour(Label) const;
 
@@ -56,22 +63,39 @@ class LIBINTERVALXT_API Component : boost::equality_comparable<Component> {
 
   // Return a perimeter, walking around this component in counterclockwise order.
   std::vector<Side> perimeter() const;
+  Sides perimeterView() const;
 
   // The portion of the perimeter that is on the left end (from top to bottom.)
   // Note that each entry is a Connection.
   std::vector<Side> left() const;
+  Sides leftView() const;
   // The portion of the perimeter that is on the right end (from bottom to top.)
   // Note that each entry is a Connection.
   std::vector<Side> right() const;
+  Sides rightView() const;
   // The portion of the perimeter that is on the bottom (from left to right.)
   std::vector<Side> bottom() const;
+  Sides bottomView() const;
   // The portion of the perimeter that is on the top (from right to left.)
   std::vector<Side> top() const;
+  Sides topView() const;
 
   DynamicalDecomposition& decomposition() const;
 
+  // Perform induction on this component until a connection has been found or
+  // the limit has been reached.
   DecompositionStep decompositionStep(int limit = -1);
 
+  // Perform induction on this component until a connection has been found or
+  // the limit has been reached. If equivalent is false, the returned
+  // DecompositionStep::equivalent is not populated which saves a walk around
+  // the perimeter of this component for each connection found.
+  DecompositionStep decompositionStep(int limit, bool equivalent);
+
+  // Perform induction on this component until a connection has been found,
+  // the limit has been reached, or the budget is exhausted.
+  DecompositionStep decompositionStep(const Budget&, int limit = -1, bool equivalent = true);
+
   // Return a copy of the Interval Exchange Transformation that is underlying
   // this component. Note that the Lengths of that copy might not be identical
   // to the current Lengths object but rather its forget().
@@ -85,6 +109,16 @@ class LIBINTERVALXT_API Component : boost::equality_comparable<Component> {
       },
       int limit = -1);
 
+  // Return whether all resulting components satisfy target, i.e., target could
+  // be established for them all without reaching the limit and before the
+  // budget was exhausted.
+  bool decompose(
+      const Budget&,
+      std::function<bool(const Component&)> target = [](const auto& c) {
+        return (c.cylinder() || c.withoutPeriodicTrajectory()) ? true : false;
+      },
+      int limit = -1);
+
   // Insert (artificial) connections left and right of the given half edge. The
   // labels specify the source and target separatrices of the new connections;
   // the entries of left and right are proceeding towards the interior, the left
@@ -102,6 +136,97 @@ class LIBINTERVALXT_API Component : boost::equality_comparable<Component> {
   friend ImplementationOf<Component>;
 };
 
+// A lazy range over the half edges of a contour of a component, see
+// Component::topContourView(). Unlike Component::topContour(), this does not
+// copy the contour but walks the component directly. Therefore, the range and
+// its iterators must not be used anymore once the component has changed,
+// e.g., in a decompositionStep(). The iterators hold on to the component
+// themselves, so they can outlive their range.
+class LIBINTERVALXT_API Component::HalfEdges {
+  HalfEdges(const Component&, bool top);
+
+ public:
+  class LIBINTERVALXT_API iterator : boost::equality_comparable<iterator> {
+    template <typename... Args>
+    iterator(PrivateConstructor, const Component&, Args&&... args);
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = HalfEdge;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = HalfEdge;
+
+    HalfEdge operator*() const;
+    iterator& operator++();
+    iterator operator++(int);
+
+    bool operator==(const iterator&) const;
+
+   private:
+    Component component;
+    // The current position on the contour.
+    Copyable<iterator> self;
+
+    friend ImplementationOf<iterator>;
+  };
+
+  iterator begin() const;
+  iterator end() const;
+
+ private:
+  Component component;
+  bool top;
+
+  friend Component;
+};
+
+// A lazy range over a portion of the perimeter of a component, see
+// Component::perimeterView(). Unlike Component::perimeter(), this does not
+// create a vector of sides but walks the component directly. Therefore, the
+// range and its iterators must not be used anymore once the component has
+// changed, e.g., in a decompositionStep(). The iterators hold on to the
+// component themselves, so they can outlive their range.
+class LIBINTERVALXT_API Component::Sides {
+  Sides(const Component&, int begin, int end);
+
+ public:
+  class LIBINTERVALXT_API iterator : boost::equality_comparable<iterator> {
+    template <typename... Args>
+    iterator(PrivateConstructor, const Component&, Args&&... args);
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Side;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Side;
+
+    Side operator*() const;
+    iterator& operator++();
+    iterator operator++(int);
+
+    bool operator==(const iterator&) const;
+
+   private:
+    Component component;
+    // The current position on the perimeter.
+    Copyable<iterator> self;
+
+    friend ImplementationOf<iterator>;
+  };
+
+  iterator begin() const;
+  iterator end() const;
+
+ private:
+  Component component;
+  int first;
+  int last;
+
+  friend Component;
+};
+
 LIBINTERVALXT_API std::ostream& operator<<(std::ostream&, const Side&);
 
 }  // namespace intervalxt
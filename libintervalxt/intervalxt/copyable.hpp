@@ -18,17 +18,93 @@
  *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
  *********************************************************************/
 
-#ifndef LIBINTERVALXT_COPYABLE
+#ifndef LIBINTERVALXT_COPYABLE_HPP
+#define LIBINTERVALXT_COPYABLE_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
-#include "external/spimpl/spimpl.h"
 #include "forward.hpp"
 
 namespace intervalxt {
 
 // A pointer-to-implementation (pimpl) for types that are copyable and
 // moveable. Such types are copied by copying this underlying pimpl.
+// The implementation is not allocated on the heap but stored inline in a
+// buffer of fixed size. The types using this are essentially handles into a
+// DynamicalDecomposition, so creating and copying them should be cheap.
 template <typename T>
-using Copyable = spimpl::impl_ptr<ImplementationOf<T>>;
+class Copyable {
+  using Implementation = ImplementationOf<T>;
+
+  static constexpr size_t capacity = 64;
+
+  // Type-erased copy, move, and destruction of the implementation, so that
+  // the implementation needs to be complete only where it is created.
+  struct Operations {
+    void (*copy)(void* target, const void* source);
+    void (*move)(void* target, void* source) noexcept;
+    void (*destroy)(void* self) noexcept;
+  };
+
+  template <typename Impl>
+  static constexpr Operations operations = {
+      [](void* target, const void* source) { new (target) Impl(*static_cast<const Impl*>(source)); },
+      [](void* target, void* source) noexcept { new (target) Impl(std::move(*static_cast<Impl*>(source))); },
+      [](void* self) noexcept { static_cast<Impl*>(self)->~Impl(); },
+  };
+
+ public:
+  template <typename... Args>
+  explicit Copyable(std::in_place_t, Args&&... args) :
+    ops(&operations<Implementation>) {
+    static_assert(sizeof(Implementation) <= capacity, "implementation does not fit into the inline storage of Copyable");
+    static_assert(alignof(Implementation) <= alignof(std::max_align_t), "implementation is over-aligned for Copyable");
+    static_assert(std::is_nothrow_move_constructible_v<Implementation>, "implementation must be nothrow move constructible");
+    new (&storage) Implementation(std::forward<Args>(args)...);
+  }
+
+  Copyable(const Copyable& other) :
+    ops(other.ops) {
+    ops->copy(&storage, &other.storage);
+  }
+
+  Copyable(Copyable&& other) noexcept :
+    ops(other.ops) {
+    ops->move(&storage, &other.storage);
+  }
+
+  Copyable& operator=(const Copyable& rhs) {
+    if (this != &rhs) {
+      Copyable copy(rhs);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  Copyable& operator=(Copyable&& rhs) noexcept {
+    if (this != &rhs) {
+      ops->destroy(&storage);
+      ops = rhs.ops;
+      ops->move(&storage, &rhs.storage);
+    }
+    return *this;
+  }
+
+  ~Copyable() { ops->destroy(&storage); }
+
+  // Like a pointer, this does not propagate const to the implementation.
+  Implementation* operator->() const noexcept { return get(); }
+  Implementation& operator*() const noexcept { return *get(); }
+
+ private:
+  Implementation* get() const noexcept { return std::launder(reinterpret_cast<Implementation*>(&storage)); }
+
+  const Operations* ops;
+  mutable std::aligned_storage_t<capacity, alignof(std::max_align_t)> storage;
+};
 
 }  // namespace intervalxt
 
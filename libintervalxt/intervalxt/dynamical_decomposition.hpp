@@ -25,6 +25,7 @@
 #include <boost/operators.hpp>
 #include <functional>
 #include <iosfwd>
+#include <optional>
 #include <vector>
 
 #include "component.hpp"
@@ -48,8 +49,46 @@ class LIBINTERVALXT_API DynamicalDecomposition : boost::equality_comparable<Dyna
       },
       int limit = -1);
 
+  // Return whether all resulting components satisfy target, i.e., target could
+  // be established for them all without reaching the limit.
+  // If threads is not 1, the components (and the components split off from
+  // them) are decomposed concurrently on that many threads; with 0 meaning
+  // one thread per hardware thread. In that case, target is never called
+  // concurrently with itself, and the Lengths of distinct components must be
+  // safe to use from different threads, even though they are usually derived
+  // from the same lengths and share their parent, e.g., a number field.
+  // The Lengths in sample/ serialize their arithmetic if necessary, see
+  // sample::ArithmeticLock. Note that this serializes every single operation
+  // on, e.g., elements of a number field, so for such lengths, decomposing
+  // on several threads is hardly faster than decomposing on one thread.
+  bool decompose(std::function<bool(const Component&)> target, int limit, unsigned int threads);
+
+  // Return whether all resulting components satisfy target, i.e., target could
+  // be established for them all without reaching the limit and before the
+  // budget was exhausted. All threads share the same budget.
+  bool decompose(
+      const Budget&,
+      std::function<bool(const Component&)> target = [](const auto& c) {
+        return (c.cylinder() || c.withoutPeriodicTrajectory()) ? true : false;
+      },
+      int limit = -1,
+      unsigned int threads = 1);
+
   std::vector<Component> components() const;
 
+  // Return a consistent copy of this decomposition that can be read while
+  // another thread keeps decomposing this decomposition, e.g., to monitor the
+  // progress of a long running decompose().
+  // A fresh copy is published by the decomposing thread at the beginning of
+  // its next decompositionStep() or when decompose() returns; until then,
+  // the copy published previously is returned (or nothing if no copy has
+  // been published yet.) Every call returns a separate copy of the published
+  // state which the caller is free to modify. This does not slow down the
+  // decomposing thread unless snapshots are being requested.
+  // Snapshots are not updated while components are decomposed on several
+  // threads; the final state is published once decompose() returns.
+  std::optional<DynamicalDecomposition> snapshot() const;
+
   bool operator==(const DynamicalDecomposition&) const;
 
   LIBINTERVALXT_API friend std::ostream& operator<<(std::ostream&, const DynamicalDecomposition&);
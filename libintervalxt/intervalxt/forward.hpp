@@ -30,6 +30,8 @@
 
 namespace intervalxt {
 
+class Budget;
+
 class Component;
 
 class Connection;
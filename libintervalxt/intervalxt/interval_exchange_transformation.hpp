@@ -46,6 +46,10 @@ class LIBINTERVALXT_API IntervalExchangeTransformation : boost::equality_compara
   // is found. Set to -1 for no limit on the number of steps.
   InductionStep induce(int limit = -1);
 
+  // Perform up to limit many steps of full Zorich induction until a connection
+  // is found or the budget is exhausted.
+  InductionStep induce(const Budget&, int limit = -1);
+
   // check for reductibility
   std::optional<IntervalExchangeTransformation> reduce();
 
@@ -21,6 +21,7 @@
 #ifndef LIBINTERVALXT_INTERVALXT_HPP
 #define LIBINTERVALXT_INTERVALXT_HPP
 
+#include "budget.hpp"
 #include "component.hpp"
 #include "connection.hpp"
 #include "decomposition_step.hpp"
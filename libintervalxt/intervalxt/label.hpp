@@ -35,13 +35,19 @@ namespace intervalxt {
 class LIBINTERVALXT_API Label : public boost::equality_comparable<Label>,
                                 public Serializable<Label> {
  public:
+  // Create a fresh label that is distinct from all labels created by this
+  // constructor before and from all labels Label(id) for small ids.
   Label() noexcept;
+
+  // Create the label with the given id. Lengths implementations should use
+  // dense ids 0, 1, 2, … for their labels so that they can use the id as an
+  // index into their storage.
   explicit Label(size_t id);
 
   bool operator==(const Label&) const;
 
   // Write the internal id of this label to the output stream.
-  // Note that this prints just some random id that is meant as a fallback to
+  // Note that this prints just some internal id that is meant as a fallback to
   // just print something when the corresponding Lengths object is not
   // available.
   // Only the Lengths object knows a meaningful name for this id which can be
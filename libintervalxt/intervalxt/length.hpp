@@ -21,45 +21,201 @@
 #ifndef LIBINTERVALXT_LENGTH_HPP
 #define LIBINTERVALXT_LENGTH_HPP
 
-#include <boost/type_erasure/any.hpp>
-#include <boost/type_erasure/member.hpp>
-#include <boost/type_erasure/operators.hpp>
-#include <string>
+#include <cstddef>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
 
 #include "forward.hpp"
 
 namespace intervalxt {
 
-template <class T = boost::type_erasure::_self>
-struct boolable {
-  static bool apply(const T& arg) { return static_cast<bool>(arg); }
-};
+// A type-erased length of an interval such as the ones returned by
+// Lengths::get().
+// Arguably, this is a bit incomplete. One could imagine more relevant
+// operations here but we want the implementation to rely on Lengths and not on
+// Length.
+// The underlying length is stored inline (and not on the heap) if it fits
+// into a small buffer and can be moved without throwing, which is the case
+// for the common numeric types such as int, mpz_class, mpq_class, and
+// renf_elem_class. All operations dispatch through a static table of
+// function pointers for each underlying type.
+class Length {
+  // Detects whether T can be tested for zero like a length. This rules out,
+  // e.g., containers of lengths which would otherwise be implicitly
+  // convertible to a Length.
+  template <typename T>
+  static auto boxable(int) -> decltype(static_cast<bool>(std::declval<const T&>()), std::true_type());
 
-}  // namespace intervalxt
+  template <typename T>
+  static std::false_type boxable(...);
 
-template <class T, class Base>
-struct boost::type_erasure::concept_interface<intervalxt::boolable<T>, Base, T> : Base {
-  explicit operator bool() const { return ::boost::type_erasure::call(intervalxt::boolable<T>(), *this); }
-};
+ public:
+  // Create an empty length that holds no value.
+  Length() noexcept {}
 
-namespace intervalxt {
+  template <typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, Length>>, typename = std::enable_if_t<decltype(boxable<std::decay_t<T>>(0))::value>>
+  Length(T&& value) :
+    vtable(&table<std::decay_t<T>>) {
+    using S = std::decay_t<T>;
+    if constexpr (inlined<S>)
+      new (&storage) S(std::forward<T>(value));
+    else
+      new (&storage) S*(new S(std::forward<T>(value)));
+  }
 
-struct LengthInterface;
+  Length(const Length& other) :
+    vtable(other.vtable) {
+    if (vtable) vtable->copy(&storage, &other.storage);
+  }
 
-using Length = boost::type_erasure::any<LengthInterface>;
+  Length(Length&& other) noexcept :
+    vtable(other.vtable) {
+    if (vtable) vtable->move(&storage, &other.storage);
+    other.vtable = nullptr;
+  }
 
-// Arguably, this is a bit incomplete. One could imagine more relevant
-// operations here but we want the implementation to rely on Lengths and not on
-// Length.
-struct LengthInterface : boost::mpl::vector<
-                             boost::type_erasure::copy_constructible<>,
-                             boost::type_erasure::equality_comparable<>,
-                             boost::type_erasure::less_than_comparable<>,
-                             boost::type_erasure::multipliable<>,
-                             boost::type_erasure::ostreamable<>,
-                             intervalxt::boolable<>,
-                             boost::type_erasure::typeid_<>,
-                             boost::type_erasure::relaxed> {
+  Length& operator=(const Length& rhs) {
+    if (this != &rhs) {
+      Length copy(rhs);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  Length& operator=(Length&& rhs) noexcept {
+    if (this != &rhs) {
+      reset();
+      vtable = rhs.vtable;
+      if (vtable) vtable->move(&storage, &rhs.storage);
+      rhs.vtable = nullptr;
+    }
+    return *this;
+  }
+
+  ~Length() { reset(); }
+
+  // Return the type of the underlying length or typeid(void) if this length
+  // is empty.
+  const std::type_info& type() const noexcept {
+    return vtable ? vtable->type() : typeid(void);
+  }
+
+  // Return a pointer to the underlying length if it is of type T; otherwise
+  // return nullptr.
+  template <typename T>
+  const T* target() const noexcept {
+    return type() == typeid(T) ? &get<T>(&storage) : nullptr;
+  }
+
+  explicit operator bool() const {
+    return vtable && vtable->boolean(&storage);
+  }
+
+  // Two lengths are equal if they are of the same type and their underlying
+  // values are equal.
+  friend bool operator==(const Length& lhs, const Length& rhs) {
+    if (lhs.vtable != rhs.vtable)
+      return lhs.type() == rhs.type() && lhs.vtable->equal(&lhs.storage, &rhs.storage);
+    return !lhs.vtable || lhs.vtable->equal(&lhs.storage, &rhs.storage);
+  }
+
+  friend bool operator!=(const Length& lhs, const Length& rhs) { return !(lhs == rhs); }
+
+  // Lengths of different types are ordered by their type.
+  friend bool operator<(const Length& lhs, const Length& rhs) {
+    if (lhs.type() != rhs.type())
+      return lhs.type().before(rhs.type());
+    return lhs.vtable && lhs.vtable->less(&lhs.storage, &rhs.storage);
+  }
+
+  friend bool operator>(const Length& lhs, const Length& rhs) { return rhs < lhs; }
+  friend bool operator<=(const Length& lhs, const Length& rhs) { return !(rhs < lhs); }
+  friend bool operator>=(const Length& lhs, const Length& rhs) { return !(lhs < rhs); }
+
+  friend Length operator*(const Length& lhs, const Length& rhs) {
+    if (!lhs.vtable || lhs.type() != rhs.type())
+      throw std::invalid_argument("can only multiply lengths of the same type");
+    return lhs.vtable->multiply(&lhs.storage, &rhs.storage);
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const Length& self) {
+    if (self.vtable)
+      self.vtable->print(os, &self.storage);
+    return os;
+  }
+
+ private:
+  static constexpr std::size_t capacity = 128;
+
+  using Storage = std::byte[capacity];
+
+  template <typename T>
+  static constexpr bool inlined = sizeof(T) <= capacity && alignof(T) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<T>;
+
+  struct VTable {
+    void (*copy)(Storage* target, const Storage* source);
+    // Move source into target and destroy source, i.e., source is empty
+    // afterwards.
+    void (*move)(Storage* target, Storage* source) noexcept;
+    void (*destroy)(Storage*) noexcept;
+    const std::type_info& (*type)() noexcept;
+    bool (*boolean)(const Storage*);
+    bool (*equal)(const Storage*, const Storage*);
+    bool (*less)(const Storage*, const Storage*);
+    Length (*multiply)(const Storage*, const Storage*);
+    void (*print)(std::ostream&, const Storage*);
+  };
+
+  template <typename T>
+  static const T& get(const Storage* storage) noexcept {
+    if constexpr (inlined<T>)
+      return *std::launder(reinterpret_cast<const T*>(storage));
+    else
+      return **std::launder(reinterpret_cast<T* const*>(storage));
+  }
+
+  template <typename T>
+  static constexpr VTable table = {
+      [](Storage* target, const Storage* source) {
+        if constexpr (inlined<T>)
+          new (target) T(get<T>(source));
+        else
+          new (target) T*(new T(get<T>(source)));
+      },
+      [](Storage* target, Storage* source) noexcept {
+        if constexpr (inlined<T>) {
+          T& value = *std::launder(reinterpret_cast<T*>(source));
+          new (target) T(std::move(value));
+          value.~T();
+        } else {
+          new (target) T*(*std::launder(reinterpret_cast<T**>(source)));
+        }
+      },
+      [](Storage* storage) noexcept {
+        if constexpr (inlined<T>)
+          std::launder(reinterpret_cast<T*>(storage))->~T();
+        else
+          delete *std::launder(reinterpret_cast<T**>(storage));
+      },
+      []() noexcept -> const std::type_info& { return typeid(T); },
+      [](const Storage* storage) { return static_cast<bool>(get<T>(storage)); },
+      [](const Storage* lhs, const Storage* rhs) { return static_cast<bool>(get<T>(lhs) == get<T>(rhs)); },
+      [](const Storage* lhs, const Storage* rhs) { return static_cast<bool>(get<T>(lhs) < get<T>(rhs)); },
+      [](const Storage* lhs, const Storage* rhs) { return Length(T(get<T>(lhs) * get<T>(rhs))); },
+      [](std::ostream& os, const Storage* storage) { os << get<T>(storage); },
+  };
+
+  void reset() noexcept {
+    if (vtable) vtable->destroy(&storage);
+    vtable = nullptr;
+  }
+
+  const VTable* vtable = nullptr;
+  alignas(std::max_align_t) Storage storage;
 };
 
 }  // namespace intervalxt
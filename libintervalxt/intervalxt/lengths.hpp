@@ -23,61 +23,190 @@
 
 #include <gmpxx.h>
 
-#include <boost/type_erasure/any.hpp>
-#include <boost/type_erasure/member.hpp>
-#include <boost/type_erasure/operators.hpp>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <typeinfo>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
-#include "erased/boost.hpp"
 #include "erased/serializable.hpp"
 #include "label.hpp"
 #include "length.hpp"
 
 namespace intervalxt {
 
-BOOST_TYPE_ERASURE_MEMBER((has_member_push), push, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_pop), pop, 0)
-BOOST_TYPE_ERASURE_MEMBER((has_member_subtract), subtract, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_subtract_repeated), subtractRepeated, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_coefficients), coefficients, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_cmp1), cmp, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_cmp2), cmp, 2)
-BOOST_TYPE_ERASURE_MEMBER((has_member_similar), similar, 5)
-BOOST_TYPE_ERASURE_MEMBER((has_member_get), get, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_render), render, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_only), only, 1)
-BOOST_TYPE_ERASURE_MEMBER((has_member_forget), forget, 0)
-
-struct LengthsInterface;
-
-using Lengths = boost::type_erasure::any<LengthsInterface>;
-
-struct LengthsInterface : boost::mpl::vector<
-                              boost::type_erasure::copy_constructible<>,
-                              has_member_push<void(Label)>,
-                              has_member_pop<void()>,
-                              has_member_subtract<void(Label)>,
-                              has_member_subtract_repeated<Label(Label)>,
-                              has_member_coefficients<std::vector<std::vector<mpq_class>>(const std::vector<Label>&) const>,
-                              has_member_cmp1<int(Label) const>,
-                              has_member_cmp2<int(Label, Label) const>,
-                              has_member_get<Length(Label) const>,
-                              has_member_render<std::string(Label) const>,
-                              // Return Lengths ignoring any labels not in the passed set of labels.
-                              has_member_only<Lengths(const std::unordered_set<Label>&) const>,
-                              // Return Lengths without any additional tracking of structure such as
-                              // keeping track of detected/injected connections.
-                              has_member_forget<Lengths() const>,
-                              // Return whether for this Lengths and labels a, b the quotient of
-                              // length(a)/length(b) is the same as the quotient of lengths(aa)/lengths(bb)
-                              // for the other Lengths.
-                              has_member_similar<bool(Label, Label, const Lengths&, Label, Label) const>,
-                              intervalxt::erased::is_serializable<Lengths>,
-                              boost::type_erasure::typeid_<>,
-                              boost::type_erasure::relaxed> {
+// Type-erased lengths of the intervals of an IntervalExchangeTransformation.
+// Any type that provides the methods below can be stored in Lengths, see
+// sample::Lengths for an example.
+// Like Length, the underlying lengths are stored inline (and not on the
+// heap) if they fit into a small buffer and can be moved without throwing,
+// which is the case for the lengths in sample/. All operations dispatch
+// through a static table of function pointers for each underlying type.
+class Lengths {
+  // Detects whether T implements the interface of Lengths. This rules out,
+  // e.g., a single Length which would otherwise be implicitly convertible to
+  // Lengths.
+  template <typename T>
+  static auto erasable(int) -> decltype(std::declval<const T&>().cmp(std::declval<Label>(), std::declval<Label>()), std::true_type());
+
+  template <typename T>
+  static std::false_type erasable(...);
+
+ public:
+  // Create empty lengths that hold no value. Calling any of the methods
+  // below on such lengths throws.
+  Lengths() noexcept {}
+
+  template <typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, Lengths>>, typename = std::enable_if_t<decltype(erasable<std::decay_t<T>>(0))::value>>
+  Lengths(T&& value) :
+    vtable(&table<std::decay_t<T>>) {
+    using S = std::decay_t<T>;
+    if constexpr (inlined<S>)
+      new (storage) S(std::forward<T>(value));
+    else
+      new (storage) S*(new S(std::forward<T>(value)));
+  }
+
+  Lengths(const Lengths& other) :
+    vtable(other.vtable) {
+    if (vtable) vtable->copy(storage, other.storage);
+  }
+
+  Lengths(Lengths&& other) noexcept :
+    vtable(other.vtable) {
+    if (vtable) vtable->move(storage, other.storage);
+    other.vtable = nullptr;
+  }
+
+  Lengths& operator=(const Lengths& rhs) {
+    if (this != &rhs) {
+      Lengths copy(rhs);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  Lengths& operator=(Lengths&& rhs) noexcept {
+    if (this != &rhs) {
+      reset();
+      vtable = rhs.vtable;
+      if (vtable) vtable->move(storage, rhs.storage);
+      rhs.vtable = nullptr;
+    }
+    return *this;
+  }
+
+  ~Lengths() { reset(); }
+
+  // Return the type of the underlying lengths or typeid(void) if these
+  // lengths are empty.
+  const std::type_info& type() const noexcept {
+    return vtable ? vtable->type() : typeid(void);
+  }
+
+  // Return a pointer to the underlying lengths if they are of type T;
+  // otherwise return nullptr.
+  template <typename T>
+  T* target() noexcept {
+    return type() == typeid(T) ? &unerased<T>(storage) : nullptr;
+  }
+
+  template <typename T>
+  const T* target() const noexcept {
+    return type() == typeid(T) ? &unerased<T>(storage) : nullptr;
+  }
+
+  void push(Label label) { dispatch().push(storage, label); }
+  void pop() { dispatch().pop(storage); }
+  void subtract(Label label) { dispatch().subtract(storage, label); }
+  Label subtractRepeated(Label label) { return dispatch().subtractRepeated(storage, label); }
+  std::vector<std::vector<mpq_class>> coefficients(const std::vector<Label>& labels) const { return dispatch().coefficients(storage, labels); }
+  int cmp(Label label) const { return dispatch().cmp1(storage, label); }
+  int cmp(Label lhs, Label rhs) const { return dispatch().cmp2(storage, lhs, rhs); }
+  Length get(Label label) const { return dispatch().get(storage, label); }
+  std::string render(Label label) const { return dispatch().render(storage, label); }
+
+  // Return Lengths ignoring any labels not in the passed set of labels.
+  Lengths only(const std::unordered_set<Label>& labels) const { return dispatch().only(storage, labels); }
+
+  // Return Lengths without any additional tracking of structure such as
+  // keeping track of detected/injected connections.
+  Lengths forget() const { return dispatch().forget(storage); }
+
+  // Return whether for this Lengths and labels a, b the quotient of
+  // length(a)/length(b) is the same as the quotient of lengths(aa)/lengths(bb)
+  // for the other Lengths.
+  bool similar(Label a, Label b, const Lengths& other, Label aa, Label bb) const { return dispatch().similar(storage, a, b, other, aa, bb); }
+
+ private:
+  static constexpr std::size_t capacity = 256;
+
+  template <typename T>
+  static constexpr bool inlined = sizeof(T) <= capacity && alignof(T) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<T>;
+
+  struct VTable {
+    void (*copy)(std::byte* target, const std::byte* source);
+    // Move source into target and destroy source, i.e., source is empty
+    // afterwards.
+    void (*move)(std::byte* target, std::byte* source) noexcept;
+    void (*destroy)(std::byte*) noexcept;
+    const std::type_info& (*type)() noexcept;
+    void (*push)(std::byte*, Label);
+    void (*pop)(std::byte*);
+    void (*subtract)(std::byte*, Label);
+    Label (*subtractRepeated)(std::byte*, Label);
+    std::vector<std::vector<mpq_class>> (*coefficients)(const std::byte*, const std::vector<Label>&);
+    int (*cmp1)(const std::byte*, Label);
+    int (*cmp2)(const std::byte*, Label, Label);
+    Length (*get)(const std::byte*, Label);
+    std::string (*render)(const std::byte*, Label);
+    Lengths (*only)(const std::byte*, const std::unordered_set<Label>&);
+    Lengths (*forget)(const std::byte*);
+    bool (*similar)(const std::byte*, Label, Label, const Lengths&, Label, Label);
+    std::unique_ptr<erased::Serializable<Lengths>> (*serializable)(const std::byte*);
+  };
+
+  template <typename T>
+  static T& unerased(std::byte* storage) noexcept {
+    if constexpr (inlined<T>)
+      return *std::launder(reinterpret_cast<T*>(storage));
+    else
+      return **std::launder(reinterpret_cast<T**>(storage));
+  }
+
+  template <typename T>
+  static const T& unerased(const std::byte* storage) noexcept {
+    if constexpr (inlined<T>)
+      return *std::launder(reinterpret_cast<const T*>(storage));
+    else
+      return **std::launder(reinterpret_cast<T* const*>(storage));
+  }
+
+  // The table of functions for lengths of type T. It is defined below, once
+  // Lengths is complete since some of these functions return Lengths.
+  template <typename T>
+  static const VTable table;
+
+  const VTable& dispatch() const {
+    if (!vtable)
+      throw std::logic_error("cannot operate on empty Lengths");
+    return *vtable;
+  }
+
+  void reset() noexcept {
+    if (vtable) vtable->destroy(storage);
+    vtable = nullptr;
+  }
+
+  friend std::unique_ptr<erased::Serializable<Lengths>> serializable(const Lengths& self, const erased::Tag<Lengths>&) {
+    return self.dispatch().serializable(self.storage);
+  }
+
   template <typename Archive>
   friend void save(Archive& archive, const Lengths& self) {
     ::intervalxt::erased::saveErased(archive, self);
@@ -87,6 +216,49 @@ struct LengthsInterface : boost::mpl::vector<
   friend void load(Archive& archive, Lengths& self) {
     ::intervalxt::erased::loadErased(archive, self);
   }
+
+  const VTable* vtable = nullptr;
+  alignas(std::max_align_t) std::byte storage[capacity];
+};
+
+template <typename T>
+const Lengths::VTable Lengths::table = {
+    [](std::byte* target, const std::byte* source) {
+      if constexpr (inlined<T>)
+        new (target) T(unerased<T>(source));
+      else
+        new (target) T*(new T(unerased<T>(source)));
+    },
+    [](std::byte* target, std::byte* source) noexcept {
+      if constexpr (inlined<T>) {
+        T& value = *std::launder(reinterpret_cast<T*>(source));
+        new (target) T(std::move(value));
+        value.~T();
+      } else {
+        new (target) T*(*std::launder(reinterpret_cast<T**>(source)));
+      }
+    },
+    [](std::byte* storage) noexcept {
+      if constexpr (inlined<T>)
+        std::launder(reinterpret_cast<T*>(storage))->~T();
+      else
+        delete *std::launder(reinterpret_cast<T**>(storage));
+    },
+    []() noexcept -> const std::type_info& { return typeid(T); },
+    [](std::byte* storage, Label label) { unerased<T>(storage).push(label); },
+    [](std::byte* storage) { unerased<T>(storage).pop(); },
+    [](std::byte* storage, Label label) { unerased<T>(storage).subtract(label); },
+    [](std::byte* storage, Label label) -> Label { return unerased<T>(storage).subtractRepeated(label); },
+    [](const std::byte* storage, const std::vector<Label>& labels) -> std::vector<std::vector<mpq_class>> { return unerased<T>(storage).coefficients(labels); },
+    [](const std::byte* storage, Label label) -> int { return unerased<T>(storage).cmp(label); },
+    [](const std::byte* storage, Label lhs, Label rhs) -> int { return unerased<T>(storage).cmp(lhs, rhs); },
+    [](const std::byte* storage, Label label) -> Length { return unerased<T>(storage).get(label); },
+    [](const std::byte* storage, Label label) -> std::string { return unerased<T>(storage).render(label); },
+    [](const std::byte* storage, const std::unordered_set<Label>& labels) -> Lengths { return unerased<T>(storage).only(labels); },
+    [](const std::byte* storage) -> Lengths { return unerased<T>(storage).forget(); },
+    [](const std::byte* storage, Label a, Label b, const Lengths& other, Label aa, Label bb) -> bool { return unerased<T>(storage).similar(a, b, other, aa, bb); },
+    // Picks up a serializable() for T through ADL, see erased/README.md.
+    [](const std::byte* storage) -> std::unique_ptr<erased::Serializable<Lengths>> { return serializable(unerased<T>(storage), erased::Tag<Lengths>()); },
 };
 
 }  // namespace intervalxt
@@ -0,0 +1,238 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_SAMPLE_APPROXIMATION_HPP
+#define LIBINTERVALXT_SAMPLE_APPROXIMATION_HPP
+
+#include <gmpxx.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "arithmetic_lock.hpp"
+
+namespace intervalxt::sample {
+
+namespace {
+
+// A closed interval [lower, upper] of doubles containing a real number.
+// All arithmetic rounds outwards so that the result of an operation contains
+// the exact result of that operation applied to any numbers contained in the
+// operands.
+struct Enclosure {
+  Enclosure() :
+    Enclosure(0) {}
+
+  explicit Enclosure(double value) :
+    Enclosure(value, value) {}
+
+  Enclosure(double lower, double upper) :
+    lower(lower),
+    upper(upper) {}
+
+  // Return an enclosure of a number that has been rounded to value with an
+  // error of less than one unit in the last place.
+  static Enclosure around(double value) {
+    return Enclosure(down(value), up(value));
+  }
+
+  // Return an enclosure of an integer.
+  static Enclosure of(int64_t value) {
+    constexpr int64_t exact = int64_t(1) << std::numeric_limits<double>::digits;
+    if (-exact <= value && value <= exact)
+      return Enclosure(static_cast<double>(value));
+    return around(static_cast<double>(value));
+  }
+
+  // Return an enclosure of an integer.
+  static Enclosure of(const mpz_class& value) {
+    if (value.fits_slong_p())
+      return of(static_cast<int64_t>(value.get_si()));
+    return around(value.get_d());
+  }
+
+  Enclosure& operator+=(const Enclosure& rhs) {
+    lower = down(lower + rhs.lower);
+    upper = up(upper + rhs.upper);
+    return *this;
+  }
+
+  Enclosure& operator-=(const Enclosure& rhs) {
+    lower = down(lower - rhs.upper);
+    upper = up(upper - rhs.lower);
+    return *this;
+  }
+
+  Enclosure& operator*=(const Enclosure& rhs) {
+    const double products[] = {lower * rhs.lower, lower * rhs.upper, upper * rhs.lower, upper * rhs.upper};
+    if (std::any_of(std::begin(products), std::end(products), [](double product) { return std::isnan(product); })) {
+      lower = -std::numeric_limits<double>::infinity();
+      upper = std::numeric_limits<double>::infinity();
+      return *this;
+    }
+    lower = down(*std::min_element(std::begin(products), std::end(products)));
+    upper = up(*std::max_element(std::begin(products), std::end(products)));
+    return *this;
+  }
+
+  friend Enclosure operator+(Enclosure lhs, const Enclosure& rhs) { return lhs += rhs; }
+  friend Enclosure operator-(Enclosure lhs, const Enclosure& rhs) { return lhs -= rhs; }
+  friend Enclosure operator*(Enclosure lhs, const Enclosure& rhs) { return lhs *= rhs; }
+
+  // Return the sign of the numbers in this enclosure if it is determined,
+  // i.e., -1 or 1, or 0 if the enclosure contains zero.
+  // Note that this never decides that a number is zero.
+  int sign() const {
+    if (upper < 0) return -1;
+    if (lower > 0) return 1;
+    return 0;
+  }
+
+  double lower;
+  double upper;
+
+ private:
+  static double down(double value) { return std::nextafter(value, -std::numeric_limits<double>::infinity()); }
+  static double up(double value) { return std::nextafter(value, std::numeric_limits<double>::infinity()); }
+};
+
+// Counts the comparisons performed by lengths that use approximations, how
+// many times an approximation had to be recomputed at a higher precision,
+// and how many comparisons had to fall back to exact arithmetic because the
+// approximations were not sufficient to decide them.
+// These statistics are shared by all lengths derived from the same initial
+// lengths, e.g., by the lengths of all the components of a decomposition.
+// The counters are atomic since comparisons can be performed concurrently,
+// see Lengths::Sum. To not make cheap comparisons contend for these
+// counters, they are only maintained for types whose arithmetic is
+// serialized by an ArithmeticLock anyway, e.g., not for integers.
+struct ApproximationStatistics {
+  std::atomic<size_t> comparisons = 0;
+  std::atomic<size_t> refinements = 0;
+  std::atomic<size_t> exact = 0;
+};
+
+// Returns an Enclosure of an element of type S, i.e., an interval of doubles
+// that contains the element. Providing a specialization of this class is
+// optional; sample::CoordinateLengths requires one, sample::Lengths uses one
+// if it is available.
+// See the other files in this directory for some examples.
+template <typename S = void, typename _ = void>
+struct Approximation {
+ private:
+  template <typename>
+  static constexpr bool false_t = false;
+
+ public:
+  using T = S;
+
+  // Marks this template as not implemented so that lengths can detect
+  // whether an approximation is available, see approximates.
+  using unavailable = void;
+
+  Enclosure operator()(const T&) {
+    static_assert(false_t<T>, "operator() returning an approximation of this element not implemented; did you include the appropriate approximation header?");
+    throw std::logic_error("not implemented: Approximation::operator(); did you include the appropriate approximation header?");
+  }
+
+  // An Approximation can optionally also provide
+  //   Enclosure operator()(const std::vector<T>& elements, const std::vector<mpz_class>& coefficients, long prec)
+  // returning an enclosure of Σ coefficients[i]·elements[i] computed with
+  // a working precision of prec bits, and a
+  //   static long maximumPrecision
+  // up to which such approximations should be refined before giving up.
+  // Lengths then use this to refine approximations lazily when the default
+  // approximations cannot decide a comparison, see refinedSign().
+};
+
+// Whether the Approximation A has been implemented.
+template <typename A, typename = void>
+constexpr bool approximates = true;
+
+template <typename A>
+constexpr bool approximates<A, std::void_t<typename A::unavailable>> = false;
+
+// Whether the Approximation A can be refined to a higher precision.
+template <typename A, typename = void>
+constexpr bool refines = false;
+
+template <typename A>
+constexpr bool refines<A, std::void_t<decltype(std::declval<A&>()(std::declval<const std::vector<typename A::T>&>(), std::declval<const std::vector<mpz_class>&>(), 0l)), decltype(A::maximumPrecision)>> = true;
+
+// Return the sign of Σ coefficients[i]·elements[i] if it can be decided by
+// refining the Approximation A; otherwise return 0.
+template <typename A, typename T>
+int refinedSign(const std::vector<T>& elements, const std::vector<mpz_class>& coefficients, ApproximationStatistics& statistics) {
+  if constexpr (refines<A>) {
+    for (long prec = 128; prec <= A::maximumPrecision; prec *= 2) {
+      if constexpr (serializes<T>)
+        statistics.refinements++;
+      if (const int sign = A()(elements, coefficients, prec).sign())
+        return sign;
+    }
+  }
+  return 0;
+}
+
+// Return the floor of divident / divisor if it can be guessed from the
+// Approximation of the arguments. The guess is certified with exact
+// arithmetic in T, i.e., by checking that 0 ≤ divident - quotient·divisor <
+// divisor; if that fails, return nothing.
+template <typename T>
+std::optional<mpz_class> approximateFloorDivision(const T& divident, const T& divisor) {
+  const Enclosure numerator = Approximation<T>()(divident);
+  const Enclosure denominator = Approximation<T>()(divisor);
+
+  if (denominator.lower <= 0)
+    return std::nullopt;
+
+  const double guess = std::floor((numerator.lower + numerator.upper) / (denominator.lower + denominator.upper));
+  if (!std::isfinite(guess) || std::abs(guess) > 0x1p53)
+    return std::nullopt;
+
+  mpz_class quotient = guess;
+  T remainder = divident - divisor * quotient;
+
+  // The guess is often off by one when divident / divisor is an integer.
+  if (remainder < 0) {
+    quotient -= 1;
+    remainder += divisor;
+  } else if (!(remainder < divisor)) {
+    quotient += 1;
+    remainder -= divisor;
+  }
+
+  if (remainder < 0 || !(remainder < divisor))
+    return std::nullopt;
+
+  return quotient;
+}
+
+}  // namespace
+
+}  // namespace intervalxt::sample
+
+#endif
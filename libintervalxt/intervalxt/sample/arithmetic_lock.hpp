@@ -0,0 +1,81 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_SAMPLE_ARITHMETIC_LOCK_HPP
+#define LIBINTERVALXT_SAMPLE_ARITHMETIC_LOCK_HPP
+
+#include <gmpxx.h>
+
+#include <mutex>
+#include <type_traits>
+
+#include "../forward.hpp"
+
+namespace intervalxt::sample {
+
+// Return the mutex that is locked by the default ArithmeticLock. There is a
+// single such mutex in libintervalxt so that all translation units (and all
+// shared libraries) that use sample::Lengths agree on it.
+LIBINTERVALXT_API std::recursive_mutex& arithmeticMutex();
+
+namespace {
+
+// Serializes arithmetic with elements of a type S while it is held.
+// Elements of some types share state that they modify without any
+// synchronization, even in operations that are logically const. A
+// renf_elem_class for example refines the embedding of its number field
+// when it is compared or approximated. The Lengths of the components of a
+// DynamicalDecomposition share such state, so sample::Lengths hold an
+// ArithmeticLock whenever they operate on elements of S. This makes it safe
+// to decompose these components on several threads.
+// By default, this locks arithmeticMutex(), which is shared by all such
+// types. Since it is taken for every single operation, arithmetic with
+// elements of such types, e.g., of a number field, is never performed
+// concurrently. Decomposing on several threads then hardly speeds things
+// up. Types whose elements can be used from different threads concurrently
+// (as long as the same element is not modified concurrently) should provide
+// a specialization that does not lock anything, see below.
+template <typename S, typename _ = void>
+class ArithmeticLock {
+ public:
+  ArithmeticLock() :
+    lock(arithmeticMutex()) {}
+
+ private:
+  std::lock_guard<std::recursive_mutex> lock;
+};
+
+template <typename S>
+class ArithmeticLock<S, std::enable_if_t<std::is_arithmetic_v<S>>> {};
+
+template <>
+class ArithmeticLock<mpz_class> {};
+
+template <>
+class ArithmeticLock<mpq_class> {};
+
+// Whether ArithmeticLock<S> serializes arithmetic with elements of S.
+template <typename S>
+constexpr bool serializes = !std::is_empty_v<ArithmeticLock<S>>;
+
+}  // namespace
+
+}  // namespace intervalxt::sample
+
+#endif
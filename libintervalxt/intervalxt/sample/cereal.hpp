@@ -25,21 +25,59 @@
 #include <cereal/types/vector.hpp>
 
 #include "../cereal.hpp"
+#include "coordinate_lengths.hpp"
 #include "lengths.hpp"
 
 namespace intervalxt {
 
 template <typename T>
 struct Serialization<sample::Lengths<T>> {
+  // We serialize the lengths as they appear to the user, i.e., without
+  // the labels that have been masked by only().
   template <typename Archive>
   void save(Archive& archive, const sample::Lengths<T>& self) {
-    archive(cereal::make_nvp("lengths", self.lengths));
-    archive(cereal::make_nvp("stack", self.stack));
+    std::vector<T> lengths;
+    for (const auto& label : self.labels())
+      lengths.push_back(self.at(label));
+    archive(cereal::make_nvp("lengths", lengths));
+    archive(cereal::make_nvp("stack", self.stack.labels()));
   }
 
   template <typename Archive>
   void load(Archive& archive, sample::Lengths<T>& self) {
-    archive(cereal::make_nvp("lengths", self.lengths));
+    std::vector<T> lengths;
+    archive(cereal::make_nvp("lengths", lengths));
+    self.storage = std::make_shared<typename sample::Lengths<T>::Storage>();
+    self.storage->lengths = std::move(lengths);
+    self.mask.reset();
+    std::vector<Label> stack;
+    archive(cereal::make_nvp("stack", stack));
+    self.stack.clear();
+    self.invalidate();
+    self.approximate();
+    for (const auto& label : stack)
+      self.push(label);
+  }
+};
+
+template <typename T>
+struct Serialization<sample::CoordinateLengths<T>> {
+  // We serialize the current lengths and not their coordinates. When
+  // loading, these lengths become the new basis.
+  template <typename Archive>
+  void save(Archive& archive, const sample::CoordinateLengths<T>& self) {
+    std::vector<T> lengths;
+    for (const auto& label : self.labels())
+      lengths.push_back(self.get(label));
+    archive(cereal::make_nvp("lengths", lengths));
+    archive(cereal::make_nvp("stack", self.stack));
+  }
+
+  template <typename Archive>
+  void load(Archive& archive, sample::CoordinateLengths<T>& self) {
+    std::vector<T> lengths;
+    archive(cereal::make_nvp("lengths", lengths));
+    self = sample::CoordinateLengths<T>(lengths);
     archive(cereal::make_nvp("stack", self.stack));
   }
 };
@@ -37,6 +37,16 @@ namespace {
 // You must provide a specialization of this class for each type that you want
 // to use in a sample::Lengths. See the other files in this directory for some
 // examples.
+// A specialization can declare a `static constexpr bool incremental = true`
+// to signal that the coefficients of a subset of elements are the same as
+// the ones computed for all elements whenever the returned vectors have the
+// same length. A sample::Lengths then only recomputes the coefficients of
+// lengths that changed since the last call to coefficients().
+// A specialization can also provide a `void promote(std::vector<T>&)` that
+// rewrites elements in a common parent. A sample::Lengths calls it when it is
+// created so that arithmetic and coefficients() do not need to coerce
+// elements later. Note that a sample::Lengths keeps its Coefficients object
+// around, so specializations can cache such a parent between calls.
 template <typename S = void, typename _ = void>
 class Coefficients {
   template <typename>
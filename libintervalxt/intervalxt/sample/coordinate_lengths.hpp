@@ -0,0 +1,178 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_SAMPLE_COORDINATE_LENGTHS_HPP
+#define LIBINTERVALXT_SAMPLE_COORDINATE_LENGTHS_HPP
+
+#include <gmpxx.h>
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include "../label.hpp"
+#include "../lengths.hpp"
+#include "approximation.hpp"
+#include "arithmetic_lock.hpp"
+#include "coefficients.hpp"
+#include "floor_division.hpp"
+#include "lengths.hpp"
+
+namespace intervalxt::sample {
+
+namespace {
+
+// Lengths of an interval exchange transformation that are stored as integer
+// coordinates with respect to the initial lengths.
+// Since Zorich induction only ever subtracts lengths from each other, every
+// length is an integer combination of the lengths the transformation started
+// out with. We track these combinations as rows of int64_t (promoting all of
+// them to mpz_class if an operation overflows) and decide comparisons with
+// floating point enclosures derived from these rows. Only when these
+// enclosures are not conclusive, we compute with the exact elements of T.
+// This makes induction much faster than with sample::Lengths<T> when
+// arithmetic in T is expensive, e.g., for number fields or exact-real
+// modules.
+// As for sample::Lengths, all arithmetic with elements of T happens while
+// holding an ArithmeticLock<T>.
+template <typename T, typename FloorDivision = FloorDivision<T>, typename Coefficients = Coefficients<T>, typename Approximation = Approximation<T>>
+class CoordinateLengths : public Serializable<CoordinateLengths<T>> {
+  static_assert(!std::is_integral_v<T>, "use sample::Lengths for native integer lengths");
+
+ public:
+  CoordinateLengths();
+  explicit CoordinateLengths(const std::vector<T>&);
+
+  template <typename... L>
+  static auto make(L&&... values);
+
+  std::vector<Label> labels() const;
+
+  explicit operator T() const;
+  explicit operator bool() const;
+
+  void push(Label);
+  void pop();
+  void clear();
+  int cmp(Label) const;
+  int cmp(Label, Label) const;
+  void subtract(Label);
+  Label subtractRepeated(Label);
+  std::vector<std::vector<mpq_class>> coefficients(const std::vector<Label>&) const;
+  std::string render(Label) const;
+  T get(Label) const;
+  ::intervalxt::Lengths only(const std::unordered_set<Label>&) const;
+  ::intervalxt::Lengths forget() const;
+  bool similar(Label, Label, const ::intervalxt::Lengths&, Label, Label) const;
+
+  bool operator==(const CoordinateLengths&) const;
+
+  // Return how many comparisons have been performed by these lengths and
+  // by all lengths derived from them, and how many of these comparisons
+  // could not be decided by the default approximations.
+  // Comparisons of elements that are not serialized by an ArithmeticLock,
+  // e.g., integers, are not counted.
+  const ApproximationStatistics& statistics() const;
+
+ private:
+  // The length Σ terms + multiplicity·Σstack where each of the (at most two)
+  // terms is a label with multiplicity ±1. Unlike a vector of labels and
+  // multiplicities, such a combination can be created without allocating.
+  struct Combination {
+    Combination(std::initializer_list<std::pair<Label, int>> terms, int64_t multiplicity = 0);
+    Combination(std::initializer_list<std::pair<Label, int>> terms, mpz_class multiplicity);
+
+    // Call f(label, multiplicity) for each length in this combination, where
+    // multiplicity is an int64_t or, if it does not fit, an mpz_class.
+    template <typename F>
+    void forEach(const std::vector<Label>& stack, F&& f) const;
+
+    std::array<std::pair<Label, int>, 2> terms;
+    size_t size = 0;
+    int64_t multiplicity = 0;
+    // The multiplicity of the stack if it does not fit into an int64_t.
+    std::optional<mpz_class> exactMultiplicity;
+  };
+
+  // Return the sign of the length described by the combination without
+  // changing any coordinates.
+  int sign(const Combination&) const;
+
+  // Replace the coordinates of label with the coordinates of the length
+  // described by the combination.
+  void assign(Label, const Combination&);
+
+  // Return the combination from - multiplicity * Σstack.
+  Combination remainder(Label from, int64_t multiplicity) const;
+  Combination remainder(Label from, const mpz_class& multiplicity) const;
+
+  // Recompute the enclosure of label from its coordinates.
+  void enclose(Label);
+
+  // Return whether the coordinates are stored as int64_t.
+  bool small() const;
+
+  // Move all coordinates to exactCoordinates.
+  void promote();
+
+  // Return the exact value of the length with the given coordinates.
+  template <typename Row>
+  T evaluate(const Row&) const;
+
+  friend Serialization<CoordinateLengths<T>>;
+
+  size_t size = 0;
+
+  // The lengths with respect to which all coordinates are given.
+  std::vector<T> basis;
+  std::vector<Enclosure> basisEnclosures;
+
+  // The coordinates of each length as a size × size matrix in row-major
+  // order. Once an operation overflows, smallCoordinates is cleared and all
+  // coordinates live in exactCoordinates.
+  std::vector<int64_t> smallCoordinates;
+  std::vector<mpz_class> exactCoordinates;
+
+  // An enclosure of each length, computed from its coordinates.
+  std::vector<Enclosure> enclosures;
+
+  std::vector<Label> stack;
+
+  std::shared_ptr<ApproximationStatistics> approximationStatistics = std::make_shared<ApproximationStatistics>();
+
+  // The coefficients() of the basis. Computed once when these lengths are
+  // created and shared with all lengths derived from them.
+  std::shared_ptr<const std::vector<std::vector<mpq_class>>> basisCoefficients = std::make_shared<const std::vector<std::vector<mpq_class>>>();
+};
+
+template <typename T>
+CoordinateLengths(const std::vector<T>&) -> CoordinateLengths<T>;
+
+}  // namespace
+
+}  // namespace intervalxt::sample
+
+#include "detail/coordinate_lengths.ipp"
+
+#endif
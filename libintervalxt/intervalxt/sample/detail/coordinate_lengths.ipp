@@ -0,0 +1,538 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_SAMPLE_DETAIL_COORDINATE_LENGTHS_IPP
+#define LIBINTERVALXT_SAMPLE_DETAIL_COORDINATE_LENGTHS_IPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../external/gmpxxll/mpz_class.hpp"
+#include "../../label.hpp"
+#include "../approximation.hpp"
+#include "../coefficients.hpp"
+#include "../coordinate_lengths.hpp"
+#include "../floor_division.hpp"
+#include "../lengths.hpp"
+
+namespace intervalxt::sample {
+
+namespace {
+
+// Return a buffer for the coordinates of a combination that is reused by all
+// comparisons on this thread, so that comparisons do not allocate.
+template <typename Coordinate>
+std::vector<Coordinate>& scratch() {
+  thread_local std::vector<Coordinate> row;
+  return row;
+}
+
+// Add multiplicity·coordinate to result.
+void addmul(mpz_class& result, const mpz_class& multiplicity, const mpz_class& coordinate) {
+  mpz_addmul(result.get_mpz_t(), multiplicity.get_mpz_t(), coordinate.get_mpz_t());
+}
+
+void addmul(mpz_class& result, int64_t multiplicity, const mpz_class& coordinate) {
+  if (multiplicity < std::numeric_limits<long>::min() || multiplicity > std::numeric_limits<long>::max())
+    addmul(result, gmpxxll::mpz_class(multiplicity), coordinate);
+  else if (multiplicity >= 0)
+    mpz_addmul_ui(result.get_mpz_t(), coordinate.get_mpz_t(), static_cast<unsigned long>(multiplicity));
+  else
+    mpz_submul_ui(result.get_mpz_t(), coordinate.get_mpz_t(), 0ul - static_cast<unsigned long>(multiplicity));
+}
+
+template <typename Multiplicity>
+void addmul(mpz_class& result, const Multiplicity& multiplicity, int64_t coordinate) {
+  addmul(result, multiplicity, gmpxxll::mpz_class(coordinate));
+}
+
+// Write the coordinates of the combination into result; return false if
+// this cannot be done without overflowing an int64_t.
+template <typename T, typename Combination>
+bool combine(const std::vector<int64_t>& coordinates, size_t size, const std::vector<Label>& stack, const Combination& combination, std::vector<int64_t>& result) {
+  if (combination.exactMultiplicity)
+    return false;
+
+  result.assign(size, 0);
+  bool fits = true;
+  combination.forEach(stack, [&](Label label, const auto& multiplicity) {
+    if constexpr (std::is_same_v<std::decay_t<decltype(multiplicity)>, int64_t>) {
+      const int64_t* row = &coordinates[index<T>(label) * size];
+      for (size_t j = 0; fits && j < size; j++) {
+        int64_t product;
+        if (__builtin_mul_overflow(multiplicity, row[j], &product) || __builtin_add_overflow(result[j], product, &result[j]))
+          fits = false;
+      }
+    }
+  });
+  return fits;
+}
+
+// Write the coordinates of the combination into result.
+template <typename T, typename Coordinate, typename Combination>
+void combine(const std::vector<Coordinate>& coordinates, size_t size, const std::vector<Label>& stack, const Combination& combination, std::vector<mpz_class>& result) {
+  result.resize(size);
+  for (auto& coordinate : result)
+    coordinate = 0;
+  combination.forEach(stack, [&](Label label, const auto& multiplicity) {
+    const Coordinate* row = &coordinates[index<T>(label) * size];
+    for (size_t j = 0; j < size; j++)
+      if (row[j] != 0)
+        addmul(result[j], multiplicity, row[j]);
+  });
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::CoordinateLengths() {}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::CoordinateLengths(const std::vector<T>& lengths) :
+  size(lengths.size()),
+  basis(lengths),
+  smallCoordinates(size * size),
+  enclosures(size) {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  if (std::any_of(begin(lengths), end(lengths), [](const auto& length) { return length < 0; }))
+    throw std::invalid_argument("all lengths must be non-negative");
+
+  if constexpr (promotes<Coefficients>)
+    Coefficients().promote(basis);
+
+  for (const auto& length : basis)
+    basisEnclosures.push_back(Approximation()(length));
+
+  basisCoefficients = std::make_shared<const std::vector<std::vector<mpq_class>>>(Coefficients()(basis));
+
+  for (size_t i = 0; i < size; i++) {
+    smallCoordinates[i * size + i] = 1;
+    enclosures[i] = basisEnclosures[i];
+  }
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+template <typename... L>
+auto CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::make(L&&... values) {
+  auto lengths = CoordinateLengths<T>(std::vector{values...});
+  return std::tuple_cat(
+      std::make_tuple(lengths),
+      toTuple(lengths.labels(), std::make_index_sequence<sizeof...(L)>()));
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+std::vector<Label> CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::labels() const {
+  std::vector<Label> labels;
+  for (size_t i = 0; i < size; i++) labels.push_back(Label(i));
+  return labels;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::operator T() const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  T sum = T();
+  for (const auto& label : stack)
+    sum += get(label);
+  return sum;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::operator bool() const {
+  return sign(Combination({}, 1)) != 0;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+T CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::get(Label label) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  const size_t i = index<T>(label);
+  if (i >= size)
+    throw std::out_of_range("label does not belong to these lengths");
+  if (small())
+    return evaluate(&smallCoordinates[i * size]);
+  else
+    return evaluate(&exactCoordinates[i * size]);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::push(Label label) {
+  stack.push_back(label);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::pop() {
+  stack.pop_back();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::clear() {
+  stack.clear();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+int CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::cmp(Label rhs) const {
+  return sign(Combination({{rhs, -1}}, 1));
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+int CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::cmp(Label lhs, Label rhs) const {
+  if (lhs == rhs)
+    return 0;
+  return sign(Combination({{lhs, 1}, {rhs, -1}}));
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::subtract(Label from) {
+  const auto combination = remainder(from, 1);
+  assert(sign(combination) > 0 && "all lengths must be positive.");
+  assign(from, combination);
+  clear();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Label CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::subtractRepeated(Label from) {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  if (stack.size() == 0)
+    throw std::invalid_argument("Cannot subtractRepeated() without push()");
+
+  // Determine the multiplicity such that 0 < from - multiplicity·Σstack ≤ Σstack.
+  // We first guess it from the enclosures and only resort to an exact floor
+  // division if that guess is far off.
+  Enclosure sum;
+  for (const auto& label : stack)
+    sum += enclosures[index<T>(label)];
+  const Enclosure& length = enclosures[index<T>(from)];
+
+  std::optional<mpz_class> multiplicity;
+  if (sum.lower > 0) {
+    const double guess = std::floor((length.lower + length.upper) / (sum.lower + sum.upper));
+    if (std::isfinite(guess) && std::abs(guess) < 0x1p62)
+      multiplicity = mpz_class(guess);
+  }
+
+  for (int attempt = 0;; attempt++) {
+    if (!multiplicity || attempt == 4) {
+      multiplicity = toMpz(FloorDivision()(get(from), static_cast<T>(*this)));
+      assert(multiplicity && "floor division must produce an integer");
+    }
+
+    if (sign(remainder(from, *multiplicity)) <= 0) {
+      *multiplicity -= 1;
+      continue;
+    }
+    if (sign(remainder(from, *multiplicity + 1)) > 0) {
+      *multiplicity += 1;
+      continue;
+    }
+    break;
+  }
+
+  assign(from, remainder(from, *multiplicity));
+
+  Label stop = *rbegin(stack);
+  for (Label label : stack) {
+    if (cmp(label, from) >= 0) {
+      clear();
+      return stop;
+    }
+
+    stop = label;
+    assign(from, Combination({{from, 1}, {label, -1}}));
+    assert(sign(Combination({{from, 1}})) > 0 && "all lengths must be positive.");
+  }
+
+  throw std::logic_error("Floor Division inconsistent with cmp()/subtract()");
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+std::vector<std::vector<mpq_class>> CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::coefficients(const std::vector<Label>& labels) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  // The coefficients of rational elements might be shorter than the ones of
+  // the other elements, see Coefficients::incremental, so we pad them with
+  // zeros.
+  size_t dimension = 0;
+  for (const auto& row : *basisCoefficients)
+    dimension = std::max(dimension, row.size());
+
+  std::vector<std::vector<mpq_class>> coefficients;
+  for (const auto& label : labels) {
+    const size_t i = index<T>(label);
+    std::vector<mpq_class> row(dimension);
+    for (size_t j = 0; j < size; j++) {
+      const mpz_class coordinate = small() ? gmpxxll::mpz_class(smallCoordinates[i * size + j]) : exactCoordinates[i * size + j];
+      if (coordinate == 0)
+        continue;
+      const auto& basisRow = (*basisCoefficients)[j];
+      for (size_t k = 0; k < basisRow.size(); k++)
+        row[k] += coordinate * basisRow[k];
+    }
+    coefficients.push_back(std::move(row));
+  }
+  return coefficients;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+std::string CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::render(Label label) const {
+  return renderIndex(index<T>(label));
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+::intervalxt::Lengths CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::only(const std::unordered_set<Label>& labels) const {
+  auto only = *this;
+  only.clear();
+  for (const auto label : this->labels()) {
+    if (labels.find(label) == labels.end()) {
+      const size_t i = index<T>(label);
+      if (small())
+        std::fill_n(begin(only.smallCoordinates) + i * size, size, 0);
+      else
+        std::fill_n(begin(only.exactCoordinates) + i * size, size, 0);
+      only.enclosures[i] = Enclosure();
+    }
+  }
+  return only;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+::intervalxt::Lengths CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::forget() const {
+  auto forget = *this;
+  forget.clear();
+  return forget;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+bool CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::operator==(const CoordinateLengths& other) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  if (size != other.size)
+    return false;
+  for (const auto& label : labels())
+    if (get(label) != other.get(label))
+      return false;
+  return true;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+const ApproximationStatistics& CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::statistics() const {
+  return *approximationStatistics;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+bool CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::similar(Label a, Label b, const ::intervalxt::Lengths& other, Label aa, Label bb) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  const auto x = get(a);
+  const auto otherx = other.get(aa);
+
+  if (!x && !otherx)
+    return true;
+
+  const auto y = get(b);
+  const auto othery = other.get(bb);
+
+  if (!y && !othery)
+    return true;
+
+  return x * othery == y * otherx;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+int CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::sign(const Combination& combination) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  if constexpr (serializes<T>)
+    approximationStatistics->comparisons++;
+
+  // Try to decide the sign from the enclosures of the lengths involved.
+  Enclosure approximation;
+  combination.forEach(stack, [&](Label label, const auto& multiplicity) {
+    approximation += Enclosure::of(multiplicity) * enclosures[index<T>(label)];
+  });
+  if (const int sign = approximation.sign())
+    return sign;
+
+  // Try to decide the sign from an enclosure of the combined coordinates,
+  // where cancellations happen exactly.
+  const auto decide = [&](const auto& row) {
+    if (std::all_of(begin(row), end(row), [](const auto& coordinate) { return coordinate == 0; }))
+      return 0;
+
+    approximation = Enclosure();
+    for (size_t j = 0; j < size; j++)
+      if (row[j] != 0)
+        approximation += Enclosure::of(row[j]) * basisEnclosures[j];
+    if (const int sign = approximation.sign())
+      return sign;
+
+    // Try to decide the sign with more precise approximations.
+    if constexpr (refines<Approximation>) {
+      int sign;
+      if constexpr (std::is_same_v<std::decay_t<decltype(row)>, std::vector<mpz_class>>)
+        sign = refinedSign<Approximation>(basis, row, *approximationStatistics);
+      else
+        sign = refinedSign<Approximation>(basis, std::vector<mpz_class>(begin(row), end(row)), *approximationStatistics);
+      if (sign)
+        return sign;
+    }
+
+    // The enclosures are not precise enough, compute exactly.
+    if constexpr (serializes<T>)
+      approximationStatistics->exact++;
+    return ::intervalxt::sample::cmp<T>(evaluate(row.data()), T());
+  };
+
+  if (small()) {
+    auto& row = scratch<int64_t>();
+    if (combine<T>(smallCoordinates, size, stack, combination, row))
+      return decide(row);
+  }
+
+  auto& row = scratch<mpz_class>();
+  if (small())
+    combine<T>(smallCoordinates, size, stack, combination, row);
+  else
+    combine<T>(exactCoordinates, size, stack, combination, row);
+  return decide(row);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::assign(Label label, const Combination& combination) {
+  const size_t i = index<T>(label);
+
+  if (small()) {
+    auto& row = scratch<int64_t>();
+    if (combine<T>(smallCoordinates, size, stack, combination, row))
+      std::copy(begin(row), end(row), begin(smallCoordinates) + i * size);
+    else
+      promote();
+  }
+
+  if (!small()) {
+    auto& row = scratch<mpz_class>();
+    combine<T>(exactCoordinates, size, stack, combination, row);
+    std::swap_ranges(begin(row), end(row), begin(exactCoordinates) + i * size);
+  }
+
+  enclose(label);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+typename CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::Combination CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::remainder(Label from, int64_t multiplicity) const {
+  if (multiplicity == std::numeric_limits<int64_t>::min())
+    return Combination({{from, 1}}, -gmpxxll::mpz_class(multiplicity));
+  return Combination({{from, 1}}, -multiplicity);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+typename CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::Combination CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::remainder(Label from, const mpz_class& multiplicity) const {
+  if (multiplicity.fits_slong_p())
+    return remainder(from, static_cast<int64_t>(multiplicity.get_si()));
+  return Combination({{from, 1}}, -multiplicity);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::Combination::Combination(std::initializer_list<std::pair<Label, int>> terms, int64_t multiplicity) :
+  multiplicity(multiplicity) {
+  assert(terms.size() <= this->terms.size() && "too many terms in combination");
+  for (const auto& term : terms)
+    this->terms[size++] = term;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::Combination::Combination(std::initializer_list<std::pair<Label, int>> terms, mpz_class multiplicity) :
+  Combination(terms) {
+  if (multiplicity.fits_slong_p())
+    this->multiplicity = multiplicity.get_si();
+  else
+    exactMultiplicity = std::move(multiplicity);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+template <typename F>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::Combination::forEach(const std::vector<Label>& stack, F&& f) const {
+  for (size_t i = 0; i < size; i++)
+    f(terms[i].first, static_cast<int64_t>(terms[i].second));
+
+  if (exactMultiplicity) {
+    for (const auto& label : stack)
+      f(label, *exactMultiplicity);
+  } else if (multiplicity != 0) {
+    for (const auto& label : stack)
+      f(label, multiplicity);
+  }
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::enclose(Label label) {
+  const size_t i = index<T>(label);
+  Enclosure enclosure;
+  for (size_t j = 0; j < size; j++) {
+    if (small()) {
+      if (smallCoordinates[i * size + j])
+        enclosure += Enclosure::of(smallCoordinates[i * size + j]) * basisEnclosures[j];
+    } else {
+      if (exactCoordinates[i * size + j] != 0)
+        enclosure += Enclosure::of(exactCoordinates[i * size + j]) * basisEnclosures[j];
+    }
+  }
+  enclosures[i] = enclosure;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+bool CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::small() const {
+  return exactCoordinates.empty();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::promote() {
+  for (const auto& coordinate : smallCoordinates)
+    exactCoordinates.push_back(gmpxxll::mpz_class(coordinate));
+  smallCoordinates.clear();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+template <typename Row>
+T CoordinateLengths<T, FloorDivision, Coefficients, Approximation>::evaluate(const Row& row) const {
+  T value = T();
+  for (size_t j = 0; j < size; j++) {
+    if (row[j] == 0)
+      continue;
+    else if (row[j] == 1)
+      value += basis[j];
+    else if (row[j] == -1)
+      value -= basis[j];
+    else {
+      T term = basis[j];
+      if constexpr (std::is_same_v<std::decay_t<decltype(row[j])>, int64_t>)
+        term *= gmpxxll::mpz_class(row[j]);
+      else
+        term *= row[j];
+      value += term;
+    }
+  }
+  return value;
+}
+
+}  // namespace
+
+}  // namespace intervalxt::sample
+
+#endif
@@ -21,11 +21,18 @@
 #ifndef LIBINTERVALXT_SAMPLE_DETAIL_LENGTHS_IPP
 #define LIBINTERVALXT_SAMPLE_DETAIL_LENGTHS_IPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
-#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "../../external/gmpxxll/mpz_class.hpp"
 #include "../../label.hpp"
+#include "../approximation.hpp"
 #include "../coefficients.hpp"
 #include "../floor_division.hpp"
 #include "../lengths.hpp"
@@ -42,6 +49,95 @@ size_t index(Label label) {
   return std::hash<Label>()(label);
 }
 
+// Return a name for the label with this index, i.e., a, b, …, z, A, …, Z, ab, …
+inline std::string renderIndex(size_t current) {
+  std::string ret;
+  while (current || ret.size() == 0) {
+    size_t offset = current % (2u * 26u);
+    if (offset < 26) {
+      ret += static_cast<char>('a' + offset);
+    } else {
+      ret += static_cast<char>('A' + (offset - 26));
+    }
+    current /= (2 * 26);
+  }
+  return ret;
+}
+
+// Whether the Coefficients C can be computed for a subset of the elements,
+// see Coefficients.
+template <typename C, typename = void>
+constexpr bool incremental = false;
+
+template <typename C>
+constexpr bool incremental<C, std::void_t<decltype(C::incremental)>> = C::incremental;
+
+// Whether the Coefficients C can rewrite elements in a common parent, see
+// Coefficients.
+template <typename C, typename = void>
+constexpr bool promotes = false;
+
+template <typename C>
+constexpr bool promotes<C, std::void_t<decltype(std::declval<C&>().promote(std::declval<std::vector<typename C::T>&>()))>> = true;
+
+// Return the quotient of a FloorDivision as an mpz_class if possible.
+template <typename R>
+std::optional<mpz_class> toMpz(const R& quotient) {
+  if constexpr (std::is_integral_v<R>)
+    return gmpxxll::mpz_class(quotient);
+  else if constexpr (std::is_constructible_v<mpz_class, R>)
+    return static_cast<mpz_class>(quotient);
+  else
+    return std::nullopt;
+}
+
+// Whether T supports in-place multiplication with a Q.
+template <typename T, typename Q, typename = void>
+constexpr bool multipliesInPlace = false;
+
+template <typename T, typename Q>
+constexpr bool multipliesInPlace<T, Q, std::void_t<decltype(std::declval<T&>() *= std::declval<const Q&>())>> = true;
+
+// Set target to target - multiplicity * value without allocating any
+// temporaries (if T supports this) by using scratch as intermediate storage.
+template <typename T, typename Q>
+void submul(T& target, const Q& multiplicity, const T& value, T& scratch) {
+  if constexpr (std::is_same_v<T, mpz_class> && std::is_same_v<Q, mpz_class>) {
+    mpz_submul(target.get_mpz_t(), value.get_mpz_t(), multiplicity.get_mpz_t());
+  } else if constexpr (std::is_same_v<T, mpq_class> && std::is_same_v<Q, mpz_class>) {
+    // GMP has no mpq_submul and gmpxx would promote multiplicity to a
+    // temporary mpq_class, so we multiply the numerator directly.
+    scratch = value;
+    mpz_mul(mpq_numref(scratch.get_mpq_t()), mpq_numref(scratch.get_mpq_t()), multiplicity.get_mpz_t());
+    scratch.canonicalize();
+    target -= scratch;
+  } else if constexpr (std::is_same_v<T, Q> || multipliesInPlace<T, Q>) {
+    scratch = value;
+    scratch *= multiplicity;
+    target -= scratch;
+  } else {
+    target -= multiplicity * value;
+  }
+}
+
+// Return whether lhs * rhs == lhs_ * rhs_ without allocating temporaries for
+// the products if T supports in-place multiplication.
+template <typename T>
+bool equalProducts(const T& lhs, const T& rhs, const T& lhs_, const T& rhs_) {
+  if constexpr (multipliesInPlace<T, T>) {
+    // Each thread keeps its own scratch space so that this can be called
+    // concurrently from const methods.
+    thread_local std::array<T, 2> scratch;
+    scratch[0] = lhs;
+    scratch[0] *= rhs;
+    scratch[1] = lhs_;
+    scratch[1] *= rhs_;
+    return scratch[0] == scratch[1];
+  } else {
+    return lhs * rhs == lhs_ * rhs_;
+  }
+}
+
 template <typename T>
 int cmp(const T& lhs, const T& rhs) {
   if (lhs < rhs) return -1;
@@ -49,163 +145,545 @@ int cmp(const T& lhs, const T& rhs) {
   return 0;
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-Lengths<T, FloorDivision, Coefficients>::Lengths() :
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Lengths<T, FloorDivision, Coefficients, Approximation>::Lengths() :
   stack(),
-  lengths() {}
+  storage(std::make_shared<Storage>()) {}
 
-template <typename T, typename FloorDivision, typename Coefficients>
-Lengths<T, FloorDivision, Coefficients>::Lengths(const std::vector<T>& lengths) :
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Lengths<T, FloorDivision, Coefficients, Approximation>::Lengths(const std::vector<T>& lengths) :
   stack(),
-  lengths(lengths) {
+  storage(std::make_shared<Storage>(Storage{lengths, {}})) {
+  [[maybe_unused]] ArithmeticLock<T> lock;
   if (std::any_of(begin(lengths), end(lengths), [](const auto& length) { return length < 0; }))
     throw std::invalid_argument("all lengths must be non-negative");
+
+  if constexpr (promotes<Coefficients>)
+    toCoefficients.promote(storage->lengths);
+
+  approximate();
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
 template <typename... L>
-auto Lengths<T, FloorDivision, Coefficients>::make(L&&... values) {
+auto Lengths<T, FloorDivision, Coefficients, Approximation>::make(L&&... values) {
   auto lengths = Lengths<T>(std::vector{values...});
   return std::tuple_cat(
       std::make_tuple(lengths),
       toTuple(lengths.labels(), std::make_index_sequence<sizeof...(L)>()));
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-std::vector<Label> Lengths<T, FloorDivision, Coefficients>::labels() const {
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+std::vector<Label> Lengths<T, FloorDivision, Coefficients, Approximation>::labels() const {
   std::vector<Label> labels;
-  for (int i = 0; i < lengths.size(); i++) labels.push_back(Label(i));
+  for (int i = 0; i < storage->lengths.size(); i++) labels.push_back(Label(i));
   return labels;
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-Lengths<T, FloorDivision, Coefficients>::operator T() const {
-  return std::accumulate(begin(stack), end(stack), T(), [&](T value, Label label) { return value + at(label); });
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Lengths<T, FloorDivision, Coefficients, Approximation>::operator T() const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  return stack.total;
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-T Lengths<T, FloorDivision, Coefficients>::get(Label label) const {
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+T Lengths<T, FloorDivision, Coefficients, Approximation>::get(Label label) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  if (index<T>(label) >= storage->lengths.size())
+    throw std::out_of_range("label does not belong to these lengths");
   return at(label);
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-const T& Lengths<T, FloorDivision, Coefficients>::at(Label label) const {
-  return lengths.at(index<T>(label));
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+const T& Lengths<T, FloorDivision, Coefficients, Approximation>::at(Label label) const {
+  static const T zero = T();
+
+  assert(index<T>(label) < storage->lengths.size() && "label does not belong to these lengths");
+  if (masked(label))
+    return zero;
+  return storage->lengths[index<T>(label)];
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-T& Lengths<T, FloorDivision, Coefficients>::at(Label label) {
-  return lengths.at(index<T>(label));
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+T& Lengths<T, FloorDivision, Coefficients, Approximation>::at(Label label) {
+  assert(index<T>(label) < storage->lengths.size() && "label does not belong to these lengths");
+  detach();
+  return storage->lengths[index<T>(label)];
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-void Lengths<T, FloorDivision, Coefficients>::push(Label label) {
-  stack.push_back(label);
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Enclosure Lengths<T, FloorDivision, Coefficients, Approximation>::enclosure(Label label) const {
+  if (masked(label))
+    return Enclosure();
+  return storage->enclosures[index<T>(label)];
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-void Lengths<T, FloorDivision, Coefficients>::pop() {
-  stack.pop_back();
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+bool Lengths<T, FloorDivision, Coefficients, Approximation>::masked(Label label) const {
+  return mask && !(*mask)[index<T>(label)];
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::detach() {
+  if (!mask && storage.use_count() == 1) {
+    // Another thread might just have stopped sharing storage with us; make
+    // sure that its reads of storage happen before our writes.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return;
+  }
+
+  auto detached = std::make_shared<Storage>(*storage);
+  if (mask) {
+    for (size_t i = 0; i < detached->lengths.size(); i++) {
+      if (!(*mask)[i]) {
+        detached->lengths[i] = T();
+        if constexpr (approximates<Approximation>)
+          detached->enclosures[i] = Enclosure();
+      }
+    }
+  }
+
+  storage = std::move(detached);
+  mask.reset();
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-void Lengths<T, FloorDivision, Coefficients>::clear() {
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::push(Label label) {
+  stack.push(*this, label);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::pop() {
+  stack.pop(*this);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::clear() {
   stack.clear();
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-int Lengths<T, FloorDivision, Coefficients>::cmp(Label rhs) const {
-  return ::intervalxt::sample::cmp<T>(static_cast<T>(*this), at(rhs));
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+int Lengths<T, FloorDivision, Coefficients, Approximation>::cmp(Label rhs) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  return stack.cmp(*this, rhs);
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-int Lengths<T, FloorDivision, Coefficients>::cmp(Label lhs, Label rhs) const {
-  return ::intervalxt::sample::cmp<T>(at(lhs), at(rhs));
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+int Lengths<T, FloorDivision, Coefficients, Approximation>::cmp(Label lhs, Label rhs) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  return compare(
+      [&]() { return std::pair(enclosure(lhs), enclosure(rhs)); },
+      [&]() { return ::intervalxt::sample::cmp<T>(at(lhs), at(rhs)); });
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-void Lengths<T, FloorDivision, Coefficients>::subtract(Label from) {
-  at(from) -= static_cast<T>(*this);
-  assert(at(from) > 0 && "all lengths must be positive.");
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::subtract(Label from) {
+  subtract(stack, from);
   clear();
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-Label Lengths<T, FloorDivision, Coefficients>::subtractRepeated(Label from) {
-  if (stack.size() == 0)
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Label Lengths<T, FloorDivision, Coefficients, Approximation>::subtractRepeated(Label from) {
+  const Label stop = subtractRepeated(stack, from);
+  clear();
+  return stop;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::subtract(const Sum& sum, Label from) {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  assert((&sum == &stack || sum.lengths == this) && "sum does not belong to these lengths");
+
+  track();
+
+  at(from) -= sum.total;
+  assert(at(from) > 0 && "all lengths must be positive.");
+  approximate(from);
+  if (tracking)
+    updateCoefficients(sum, from, mpz_class(1), 0);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Label Lengths<T, FloorDivision, Coefficients, Approximation>::subtractRepeated(const Sum& sum, Label from) {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  assert((&sum == &stack || sum.lengths == this) && "sum does not belong to these lengths");
+
+  if (sum.labels().size() == 0)
     throw std::invalid_argument("Cannot subtractRepeated() without push()");
 
-  auto quo = FloorDivision()(at(from), static_cast<T>(*this));
+  track();
+
+  auto quo = FloorDivision()(at(from), sum.total);
 
-  at(from) -= quo * static_cast<T>(*this);
+  submul(at(from), quo, sum.total, scratch);
+
+  // The multiplicity is only needed to update the tracked coefficients.
+  std::optional<mpz_class> multiplicity;
+  if (tracking)
+    multiplicity = toMpz(quo);
 
   assert(at(from) >= 0 && "Length cannot be negative.");
   if (at(from) == 0) {
     // Undo the last subtraction
-    at(from) += static_cast<T>(*this);
+    at(from) += sum.total;
+    if (multiplicity) *multiplicity -= 1;
   }
+  approximate(from);
 
-  Label stop = *rbegin(stack);
-  for (Label label : stack) {
-    if (at(label) >= at(from)) {
-      clear();
+  Label stop = *rbegin(sum.labels());
+  size_t prefix = 0;
+  for (Label label : sum.labels()) {
+    if (cmp(label, from) >= 0) {
+      updateCoefficients(sum, from, multiplicity, prefix);
       return stop;
     }
 
     stop = label;
     at(from) -= at(label);
+    approximate(from);
+    prefix++;
     assert(at(from) > 0 && "all lengths must be positive.");
   }
 
   throw std::logic_error("Floor Division inconsistent with cmp()/subtract()");
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-std::vector<std::vector<mpq_class>> Lengths<T, FloorDivision, Coefficients>::coefficients(const std::vector<Label>& labels) const {
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+std::vector<std::vector<mpq_class>> Lengths<T, FloorDivision, Coefficients, Approximation>::coefficients(const std::vector<Label>& labels) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+
+  // The Coefficients might cache data in their operator() but we must not
+  // modify these lengths here.
+  auto toCoefficients = this->toCoefficients;
+
+  const auto compute = [&](const auto& labels) {
+    std::vector<T> lengths;
+    for (auto& label : labels)
+      lengths.push_back(at(label));
+    return toCoefficients(lengths);
+  };
+
+  // Determine whether labels is the set of labels whose coefficients are
+  // tracked.
+  bool context = labels.size() == coefficientsContextSize;
+  if (context) {
+    std::vector<char> seen(coefficientsContext.size());
+    for (size_t i = 0; context && i < labels.size(); i++) {
+      const auto label = index<T>(labels[i]);
+      context = label < coefficientsContext.size() && coefficientsContext[label] && !seen[label];
+      if (context) seen[label] = 1;
+    }
+  }
+
+  std::vector<Label> dirty;
+  if (context) {
+    for (auto& label : labels)
+      if (!coefficientsCache[index<T>(label)])
+        dirty.push_back(label);
+
+    if (dirty.size() == labels.size())
+      context = false;
+  }
+
+  // Recompute only the coefficients of the lengths that could not be
+  // updated if the result is guaranteed to be the same as when computing
+  // all of them.
+  std::vector<std::vector<mpq_class>> recomputed;
+  if (context && dirty.size()) {
+    bool consistent = false;
+    if constexpr (incremental<Coefficients>) {
+      recomputed = compute(dirty);
+      const auto dimension = std::find_if(begin(labels), end(labels), [&](const auto& label) { return coefficientsCache[index<T>(label)]; });
+      consistent = std::all_of(begin(recomputed), end(recomputed), [&](const auto& row) { return row.size() == coefficientsCache[index<T>(*dimension)]->size(); });
+    }
+    context = consistent;
+  }
+
+  if (!context)
+    return compute(labels);
+
+  std::vector<std::vector<mpq_class>> coefficients;
+  auto next = begin(recomputed);
+  for (auto& label : labels) {
+    const auto& cached = coefficientsCache[index<T>(label)];
+    if (!cached) {
+      coefficients.push_back(std::move(*next++));
+      continue;
+    }
+
+    std::vector<mpq_class> row;
+    for (const auto& numerator : *cached) {
+      row.emplace_back(numerator, coefficientsDenominator);
+      if (coefficientsDenominator != 1)
+        row.back().canonicalize();
+    }
+    coefficients.push_back(std::move(row));
+  }
+  return coefficients;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::trackCoefficients() {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  tracking = true;
+  track();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::track() {
+  if (!tracking || !coefficientsContext.empty())
+    return;
+
+  std::vector<Label> labels;
   std::vector<T> lengths;
-  for (auto& label : labels)
-    lengths.push_back(at(label));
-  return Coefficients()(lengths);
+  for (const auto& label : this->labels()) {
+    if (!masked(label)) {
+      labels.push_back(label);
+      lengths.push_back(at(label));
+    }
+  }
+
+  const auto coefficients = toCoefficients(lengths);
+
+  coefficientsCache.assign(storage->lengths.size(), std::nullopt);
+  coefficientsContext.assign(storage->lengths.size(), 0);
+  coefficientsContextSize = labels.size();
+  coefficientsDenominator = 1;
+  for (const auto& row : coefficients)
+    for (const auto& entry : row)
+      mpz_lcm(coefficientsDenominator.get_mpz_t(), coefficientsDenominator.get_mpz_t(), entry.get_den_mpz_t());
+
+  for (size_t i = 0; i < labels.size(); i++) {
+    std::vector<mpz_class> row;
+    for (const auto& entry : coefficients[i])
+      row.push_back(entry.get_num() * (coefficientsDenominator / entry.get_den()));
+    coefficientsCache[index<T>(labels[i])] = std::move(row);
+    coefficientsContext[index<T>(labels[i])] = 1;
+  }
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-std::string Lengths<T, FloorDivision, Coefficients>::render(Label label) const {
-  std::string ret;
-  size_t current = index<T>(label);
-  while (current || ret.size() == 0) {
-    size_t offset = current % (2u * 26u);
-    if (offset < 26) {
-      ret += static_cast<char>('a' + offset);
-    } else {
-      ret += static_cast<char>('A' + (offset - 26));
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::updateCoefficients(const Sum& sum, Label from, const std::optional<mpz_class>& multiplicity, size_t prefix) {
+  if (coefficientsCache.empty())
+    return;
+
+  auto& row = coefficientsCache[index<T>(from)];
+  if (!row)
+    return;
+
+  const auto& stack = sum.labels();
+  if (!multiplicity || std::any_of(begin(stack), end(stack), [&](Label label) { return !coefficientsCache[index<T>(label)]; })) {
+    // We cannot express the new length in terms of the coordinates we know.
+    row.reset();
+    return;
+  }
+
+  // The length of from has been replaced with
+  // from - multiplicity * Σsum - Σsum[:prefix].
+  for (size_t i = 0; i < stack.size(); i++) {
+    const auto& subtrahend = *coefficientsCache[index<T>(stack[i])];
+    for (size_t j = 0; j < row->size(); j++) {
+      mpz_submul((*row)[j].get_mpz_t(), multiplicity->get_mpz_t(), subtrahend[j].get_mpz_t());
+      if (i < prefix)
+        (*row)[j] -= subtrahend[j];
     }
-    current /= (2 * 26);
   }
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::approximate() {
+  detach();
+  storage->enclosures.clear();
+  if constexpr (approximates<Approximation>)
+    for (const auto& length : storage->lengths)
+      storage->enclosures.push_back(Approximation()(length));
+
+  const auto labels = stack.labels();
+  stack.clear();
+  for (const auto& label : labels)
+    push(label);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::approximate(Label label) {
+  if constexpr (approximates<Approximation>) {
+    const auto& length = at(label);
+    storage->enclosures[index<T>(label)] = Approximation()(length);
+  }
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+template <typename Enclosures, typename Exact>
+int Lengths<T, FloorDivision, Coefficients, Approximation>::compare(Enclosures&& approximations, Exact&& exact) const {
+  if constexpr (serializes<T>)
+    approximationStatistics->comparisons++;
+  if constexpr (approximates<Approximation>) {
+    const auto [lhs, rhs] = approximations();
+    if (const int sign = (lhs - rhs).sign())
+      return sign;
+  }
+  if constexpr (serializes<T>)
+    approximationStatistics->exact++;
+  return exact();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::invalidate() {
+  coefficientsCache.clear();
+  coefficientsContext.clear();
+  coefficientsContextSize = 0;
+  coefficientsDenominator = 1;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+std::string Lengths<T, FloorDivision, Coefficients, Approximation>::render(Label label) const {
+  return renderIndex(index<T>(label));
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+::intervalxt::Lengths Lengths<T, FloorDivision, Coefficients, Approximation>::only(const std::unordered_set<Label>& labels) const {
+  // Instead of copying the lengths, we share them and mask the labels that
+  // are not in labels. The lengths are only copied when the result is
+  // modified.
+  auto only = std::make_shared<std::vector<char>>(storage->lengths.size(), 0);
+  for (const auto label : labels)
+    if (index<T>(label) < only->size())
+      (*only)[index<T>(label)] = !masked(label);
+
+  Lengths ret;
+  ret.storage = storage;
+  ret.mask = std::move(only);
+  ret.toCoefficients = toCoefficients;
+  ret.approximationStatistics = approximationStatistics;
+  ret.tracking = tracking;
   return ret;
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-::intervalxt::Lengths Lengths<T, FloorDivision, Coefficients>::only(const std::unordered_set<Label>& labels) const {
-  auto only = Lengths(lengths);
-  for (const auto label : this->labels())
-    if (labels.find(label) == labels.end())
-      only.at(label) = T();
-  return only;
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+::intervalxt::Lengths Lengths<T, FloorDivision, Coefficients, Approximation>::forget() const {
+  Lengths forget;
+  forget.storage = storage;
+  forget.mask = mask;
+  forget.toCoefficients = toCoefficients;
+  forget.approximationStatistics = approximationStatistics;
+  forget.tracking = tracking;
+  return forget;
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-::intervalxt::Lengths Lengths<T, FloorDivision, Coefficients>::forget() const {
-  return Lengths(lengths);
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+bool Lengths<T, FloorDivision, Coefficients, Approximation>::operator==(const Lengths& other) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  if (storage == other.storage && mask == other.mask)
+    return true;
+  if (storage->lengths.size() != other.storage->lengths.size())
+    return false;
+  for (const auto label : labels())
+    if (at(label) != other.at(label))
+      return false;
+  return true;
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-bool Lengths<T, FloorDivision, Coefficients>::operator==(const Lengths& other) const {
-  return lengths == other.lengths;
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+typename Lengths<T, FloorDivision, Coefficients, Approximation>::Sum Lengths<T, FloorDivision, Coefficients, Approximation>::sum() const {
+  return Sum(this);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::Sum(const Lengths* lengths) :
+  lengths(lengths) {}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::push(Label label) {
+  push(*lengths, label);
 }
 
-template <typename T, typename FloorDivision, typename Coefficients>
-bool Lengths<T, FloorDivision, Coefficients>::similar(Label a, Label b, const ::intervalxt::Lengths& other, Label aa, Label bb) const {
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::push(const Lengths& lengths, Label label) {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  stack.push_back(label);
+  total += lengths.at(label);
+  if constexpr (approximates<Approximation>)
+    enclosures.push_back((enclosures.empty() ? Enclosure() : enclosures.back()) + lengths.enclosure(label));
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::pop() {
+  pop(*lengths);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::pop(const Lengths& lengths) {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  total -= lengths.at(stack.back());
+  stack.pop_back();
+  if constexpr (approximates<Approximation>)
+    enclosures.pop_back();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+void Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::clear() {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  stack.clear();
+  enclosures.clear();
+  // Reset the total without releasing the memory it holds (assigning T()
+  // would move its storage away for types such as mpz_class.)
+  if constexpr (std::is_assignable_v<T&, int>)
+    total = 0;
+  else
+    total = T();
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+const std::vector<Label>& Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::labels() const {
+  return stack;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::operator T() const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  return total;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+int Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::cmp(Label rhs) const {
+  return cmp(*lengths, rhs);
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+int Lengths<T, FloorDivision, Coefficients, Approximation>::Sum::cmp(const Lengths& lengths, Label rhs) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
+  return lengths.compare(
+      [&]() { return std::pair(enclosures.empty() ? Enclosure() : enclosures.back(), lengths.enclosure(rhs)); },
+      [&]() { return ::intervalxt::sample::cmp<T>(total, lengths.at(rhs)); });
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+const ApproximationStatistics& Lengths<T, FloorDivision, Coefficients, Approximation>::statistics() const {
+  return *approximationStatistics;
+}
+
+template <typename T, typename FloorDivision, typename Coefficients, typename Approximation>
+bool Lengths<T, FloorDivision, Coefficients, Approximation>::similar(Label a, Label b, const ::intervalxt::Lengths& other, Label aa, Label bb) const {
+  [[maybe_unused]] ArithmeticLock<T> lock;
   const auto& x = at(a);
+
+  if (const auto* same = other.target<Lengths>()) {
+    // Compare without boxing the lengths into Length and without allocating
+    // temporaries for the products.
+    const auto& otherx = same->at(aa);
+
+    if (!x && !otherx)
+      return true;
+
+    const auto& y = at(b);
+    const auto& othery = same->at(bb);
+
+    if (!y && !othery)
+      return true;
+
+    return equalProducts(x, othery, y, otherx);
+  }
+
   const auto otherx = other.get(aa);
 
   if (!x && !otherx)
@@ -0,0 +1,84 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_SAMPLE_ELEMENT_APPROXIMATION_HPP
+#define LIBINTERVALXT_SAMPLE_ELEMENT_APPROXIMATION_HPP
+
+#include <exact-real/arb.hpp>
+#include <exact-real/arf.hpp>
+#include <exact-real/element.hpp>
+#include <utility>
+#include <vector>
+
+#include "approximation.hpp"
+
+namespace intervalxt::sample {
+
+namespace {
+
+template <typename Ring>
+struct Approximation<exactreal::Element<Ring>> {
+  using T = exactreal::Element<Ring>;
+
+  // The working precision used to compute the enclosing ball of an element.
+  static constexpr long prec = 64;
+
+  // The maximum working precision used when refining an approximation.
+  static inline long maximumPrecision = 1024;
+
+  Enclosure operator()(const T& x) {
+    const auto [lower, upper] = static_cast<std::pair<exactreal::Arf, exactreal::Arf>>(x.arb(prec));
+    return Enclosure(
+        arf_get_d(lower.arf_t(), ARF_RND_FLOOR),
+        arf_get_d(upper.arf_t(), ARF_RND_CEIL));
+  }
+
+  Enclosure operator()(const std::vector<T>& elements, const std::vector<mpz_class>& coefficients, long prec) {
+    arb_t sum;
+    arb_init(sum);
+    fmpz_t coefficient;
+    fmpz_init(coefficient);
+
+    for (size_t i = 0; i < elements.size(); i++) {
+      if (coefficients[i] == 0)
+        continue;
+      fmpz_set_mpz(coefficient, coefficients[i].get_mpz_t());
+      arb_addmul_fmpz(sum, elements[i].arb(prec).arb_t(), coefficient, prec);
+    }
+
+    arf_t bound;
+    arf_init(bound);
+    arb_get_lbound_arf(bound, sum, prec);
+    const double lower = arf_get_d(bound, ARF_RND_FLOOR);
+    arb_get_ubound_arf(bound, sum, prec);
+    const double upper = arf_get_d(bound, ARF_RND_CEIL);
+
+    arf_clear(bound);
+    fmpz_clear(coefficient);
+    arb_clear(sum);
+
+    return Enclosure(lower, upper);
+  }
+};
+
+}  // namespace
+
+}  // namespace intervalxt::sample
+
+#endif
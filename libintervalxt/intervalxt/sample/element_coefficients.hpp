@@ -24,7 +24,10 @@
 #include <exact-real/element.hpp>
 #include <exact-real/module.hpp>
 
+#include <algorithm>
 #include <boost/hana.hpp>
+#include <memory>
+#include <optional>
 
 #include "coefficients.hpp"
 
@@ -40,22 +43,60 @@ struct Coefficients<exactreal::Element<Ring>> {
     if (elements.size() == 0)
       return {};
 
-    auto parent = elements[0].module();
-    for (auto& x : elements)
-      parent = exactreal::Module<Ring>::span(parent, x.module());
+    // Usually, all elements live in the same module as in the previous call
+    // (in particular if they have been promoted with promote() below.) Then
+    // we do not need to compute the span of all modules nor promote.
+    const bool coerce = std::any_of(begin(elements), end(elements), [&](const auto& x) { return x.module() != parent; });
+
+    if (coerce) {
+      parent = elements[0].module();
+      for (auto& x : elements)
+        parent = exactreal::Module<Ring>::span(parent, x.module());
+    }
 
     // Detect whether the underlying exact-real is >=3.0.0
     static auto hasRationalCoefficients = boost::hana::is_valid([](auto&& element) -> decltype(element.rationalCoefficients()) { });
 
     std::vector<std::vector<mpq_class>> ret;
-    for (auto x : elements)
-      if constexpr (hasRationalCoefficients(x))
-        ret.push_back(x.promote(parent).rationalCoefficients());
+    for (const auto& element : elements) {
+      std::optional<T> coerced;
+      if (element.module() != parent)
+        coerced = promoted(element);
+      const auto& x = coerced ? *coerced : element;
+      if constexpr (hasRationalCoefficients(element))
+        ret.push_back(x.rationalCoefficients());
       else
-        ret.push_back(x.promote(parent).template coefficients<mpq_class>());
+        ret.push_back(x.template coefficients<mpq_class>());
+    }
 
     return ret;
   }
+
+  // Rewrite the elements in the module spanned by all of them so that
+  // arithmetic between them and later calls to operator() do not need to
+  // promote anymore.
+  void promote(std::vector<T>& elements) {
+    if (elements.size() == 0)
+      return;
+
+    if (std::all_of(begin(elements), end(elements), [&](const auto& x) { return x.module() == elements[0].module(); }))
+      return;
+
+    parent = elements[0].module();
+    for (auto& x : elements)
+      parent = exactreal::Module<Ring>::span(parent, x.module());
+
+    for (auto& x : elements)
+      x = promoted(x);
+  }
+
+ private:
+  T promoted(T x) const {
+    return x.promote(parent);
+  }
+
+  // The common parent of the elements of the last call.
+  std::shared_ptr<const exactreal::Module<Ring>> parent;
 };
 
 }  // namespace
@@ -22,6 +22,7 @@
 
 #include <exact-real/element.hpp>
 
+#include "element_approximation.hpp"
 #include "floor_division.hpp"
 
 namespace intervalxt::sample {
@@ -33,6 +34,10 @@ struct FloorDivision<exactreal::Element<Ring>> {
   using T = exactreal::Element<Ring>;
 
   mpz_class operator()(const T& divident, const T& divisor) {
+    // An exact floor division is expensive, so we first try to guess the
+    // quotient from floating point approximations.
+    if (const auto quotient = approximateFloorDivision(divident, divisor))
+      return *quotient;
     return divident.floordiv(divisor);
   }
 };
@@ -32,6 +32,8 @@ template <typename S>
 struct Coefficients<S, typename std::enable_if<std::is_integral_v<S>>::type> {
   using T = S;
 
+  static constexpr bool incremental = true;
+
   std::vector<std::vector<mpq_class>> operator()(const std::vector<T>& elements) {
     std::vector<std::vector<mpq_class>> ret(elements.size(), {mpq_class()});
     for (size_t i = 0; i < elements.size(); i++)
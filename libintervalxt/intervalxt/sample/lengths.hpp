@@ -23,12 +23,16 @@
 
 #include <gmpxx.h>
 
+#include <memory>
+#include <optional>
 #include <tuple>
 #include <unordered_set>
 #include <vector>
 
 #include "../label.hpp"
 #include "../lengths.hpp"
+#include "approximation.hpp"
+#include "arithmetic_lock.hpp"
 #include "coefficients.hpp"
 #include "floor_division.hpp"
 
@@ -36,7 +40,23 @@ namespace intervalxt::sample {
 
 namespace {
 
-template <typename T, typename FloorDivision = FloorDivision<T>, typename Coefficients = Coefficients<T>>
+// Lengths of an interval exchange transformation stored as elements of T.
+// If an Approximation of T is available, i.e., the corresponding
+// approximation header has been included, comparisons are first attempted
+// with cached enclosures of the lengths and only fall back to comparing
+// elements of T when these enclosures overlap.
+// The lengths are shared copy-on-write between these lengths and the lengths
+// derived from them with forget() and only() so that these operations do not
+// need to copy any elements of T.
+// Comparisons of partial sums of lengths can be performed without modifying
+// these lengths with a separate Sum, see sum(). The push()/pop() interface
+// required by ::intervalxt::Lengths is a thin wrapper around such a Sum.
+// No const method modifies these lengths, so several threads can read the
+// same lengths concurrently as long as nobody modifies them.
+// All arithmetic with elements of T happens while holding an
+// ArithmeticLock<T>, so lengths that share a parent can be used from
+// different threads.
+template <typename T, typename FloorDivision = FloorDivision<T>, typename Coefficients = Coefficients<T>, typename Approximation = Approximation<T>>
 class Lengths : public Serializable<Lengths<T>> {
  public:
   Lengths();
@@ -66,14 +86,182 @@ class Lengths : public Serializable<Lengths<T>> {
 
   bool operator==(const Lengths&) const;
 
+  // A partial sum of some of these lengths that can be compared to single
+  // lengths. This is the same as push() and cmp(Label) but it does not modify
+  // the lengths, so several sums can be used concurrently (as long as the
+  // lengths are not modified meanwhile.)
+  // A Sum is only valid while the lengths it has been created from exist and
+  // the lengths of its labels are not modified.
+  class Sum {
+   public:
+    void push(Label);
+    void pop();
+    void clear();
+
+    // Return the labels whose lengths are summed up in the order they were
+    // pushed.
+    const std::vector<Label>& labels() const;
+
+    explicit operator T() const;
+
+    // Return the sign of this sum minus the length of the label.
+    int cmp(Label) const;
+
+   private:
+    friend Lengths;
+
+    Sum() = default;
+    explicit Sum(const Lengths*);
+
+    void push(const Lengths&, Label);
+    void pop(const Lengths&);
+    int cmp(const Lengths&, Label) const;
+
+    const Lengths* lengths = nullptr;
+
+    std::vector<Label> stack;
+
+    // If Approximation is available, an enclosure of each partial sum of the
+    // stack.
+    std::vector<Enclosure> enclosures;
+
+    // The exact sum of the lengths on the stack. It is updated by push()
+    // and pop() so that comparisons do not need to modify this sum. (The
+    // sum is needed by subtract() anyway, so this hardly does any
+    // additional arithmetic.)
+    T total = T();
+  };
+
+  // Return an empty partial sum of these lengths.
+  Sum sum() const;
+
+  // Replace the length of from with from - Σsum. This is the same as
+  // subtract() after push()-ing the labels of sum.
+  // The sum must have been created from these lengths with sum() and must
+  // not contain from. It remains valid after this operation.
+  void subtract(const Sum&, Label from);
+
+  // Replace the length of from with the remainder of from modulo Σsum and
+  // then subtract the lengths on sum one by one while from does not get
+  // shorter than the next length. Return the last label that has been
+  // subtracted. This is the same as subtractRepeated() after push()-ing the
+  // labels of sum; the same conditions as for subtract(const Sum&, Label)
+  // apply.
+  Label subtractRepeated(const Sum&, Label from);
+
+  // Keep the coefficients() of the labels that are not masked up to date
+  // when these lengths are modified so that coefficients() does not need to
+  // recompute them. This makes every subtraction more expensive, so it is
+  // off by default. Lengths derived from these lengths with only() and
+  // forget() keep tracking their coefficients.
+  void trackCoefficients();
+
+  // Return how many comparisons have been performed by these lengths and
+  // by all lengths derived from them, and how many of these comparisons
+  // could not be decided by the default approximations.
+  // Comparisons of elements that are not serialized by an ArithmeticLock,
+  // e.g., integers, are not counted.
+  const ApproximationStatistics& statistics() const;
+
  private:
+  // Return the length of this label. Unlike get(), this does not check that
+  // the label actually belongs to these lengths (except in debug builds.)
+  // The non-const version detaches these lengths from any lengths they share
+  // their storage with.
   T& at(Label);
   const T& at(Label) const;
 
+  // Return the cached enclosure of the length of this label.
+  Enclosure enclosure(Label) const;
+
+  // Return whether this label has been masked by only(), i.e., whether its
+  // length is zero even though it might not be zero in the storage.
+  bool masked(Label) const;
+
+  // Make sure that these lengths are the only owner of their storage and
+  // that no labels are masked anymore so the storage can be modified.
+  void detach();
+
+  // If coefficients are tracked, compute the coefficients of all labels that
+  // are not masked and store them in coefficientsCache unless this has
+  // already been done.
+  void track();
+
+  // Update the coefficients of from after from has been replaced with
+  // from - multiplicity * Σsum - Σsum[:prefix]; if the multiplicity is
+  // not known, forget the coefficients of from instead.
+  void updateCoefficients(const Sum&, Label from, const std::optional<mpz_class>& multiplicity, size_t prefix);
+
+  // Forget all cached coefficients.
+  void invalidate();
+
+  // Recompute the cached enclosures of all lengths and of the partial sums
+  // on the stack.
+  void approximate();
+
+  // Recompute the cached enclosure of the length of this label.
+  void approximate(Label);
+
+  // Return the sign of lhs - rhs. If Approximation is available, try to
+  // decide this from the enclosures of lhs and rhs returned by
+  // approximations(); otherwise, return exact().
+  template <typename Enclosures, typename Exact>
+  int compare(Enclosures&& approximations, Exact&& exact) const;
+
   friend Serialization<Lengths<T>>;
 
-  std::vector<Label> stack;
-  std::vector<T> lengths;
+  // The lengths that have been push()-ed. This is a Sum that is not bound to
+  // these lengths, so these lengths can be copied freely.
+  Sum stack;
+
+  struct Storage {
+    std::vector<T> lengths;
+
+    // If Approximation is available, an enclosure of each length (indexed
+    // like lengths.)
+    std::vector<Enclosure> enclosures;
+  };
+
+  // The lengths (and their enclosures) which might be shared with other
+  // lengths until they are modified.
+  std::shared_ptr<Storage> storage;
+
+  // If set, only the labels whose entry is set here are part of these
+  // lengths; the lengths of all other labels are zero, see only().
+  std::shared_ptr<const std::vector<char>> mask;
+
+  std::shared_ptr<ApproximationStatistics> approximationStatistics = std::make_shared<ApproximationStatistics>();
+
+  // Computes the coefficients of lengths; it might cache data between calls,
+  // such as a common parent of the lengths. Since coefficients() must not
+  // modify these lengths, it uses a copy of this object.
+  Coefficients toCoefficients;
+
+  // Scratch space for the arithmetic in subtractRepeated() so that it does
+  // not need to allocate temporary elements of T (at least for types such as
+  // mpz_class and mpq_class.) This is not part of the state of these
+  // lengths. Since it is only used by non-const methods, const methods can
+  // be called concurrently.
+  T scratch;
+
+  // The coefficients() of each label (indexed like lengths) as computed for
+  // the labels whose entry in coefficientsContext is set, namely the labels
+  // that were not masked when these lengths were first modified.
+  // The coefficients are stored as numerators over the common
+  // coefficientsDenominator so that subtract() and subtractRepeated() can
+  // update them with the same integer row operations that they perform on
+  // the lengths. An entry is only reset when this is not possible, e.g.,
+  // because a label that is subtracted is not in the context. Then
+  // coefficients() recomputes that entry whenever it is requested.
+  // This cache is only maintained if trackCoefficients() has been called.
+  std::vector<std::optional<std::vector<mpz_class>>> coefficientsCache;
+  mpz_class coefficientsDenominator = 1;
+  std::vector<char> coefficientsContext;
+  size_t coefficientsContextSize = 0;
+
+  // Whether trackCoefficients() has been called on these lengths or on the
+  // lengths they have been derived from.
+  bool tracking = false;
 };
 
 template <typename T>
@@ -0,0 +1,48 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_SAMPLE_MPQ_APPROXIMATION_HPP
+#define LIBINTERVALXT_SAMPLE_MPQ_APPROXIMATION_HPP
+
+#include <gmpxx.h>
+
+#include "approximation.hpp"
+
+namespace intervalxt::sample {
+
+namespace {
+
+template <>
+struct Approximation<mpq_class> {
+  using T = mpq_class;
+
+  Enclosure operator()(const T& x) {
+    if (x.get_den() == 1)
+      return Enclosure::of(x.get_num());
+    // mpq_get_d() truncates, i.e., it is off by less than one unit in the
+    // last place.
+    return Enclosure::around(x.get_d());
+  }
+};
+
+}  // namespace
+
+}  // namespace intervalxt::sample
+
+#endif
@@ -33,6 +33,8 @@ template <>
 struct Coefficients<mpq_class> {
   using T = mpq_class;
 
+  static constexpr bool incremental = true;
+
   std::vector<std::vector<mpq_class>> operator()(const std::vector<T>& elements) {
     std::vector<std::vector<mpq_class>> ret;
     for (auto x : elements)
@@ -33,6 +33,8 @@ template <>
 struct Coefficients<mpz_class> {
   using T = mpz_class;
 
+  static constexpr bool incremental = true;
+
   std::vector<std::vector<mpq_class>> operator()(const std::vector<T>& elements) {
     std::vector<std::vector<mpq_class>> ret;
     for (auto x : elements)
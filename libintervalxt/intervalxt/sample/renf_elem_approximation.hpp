@@ -0,0 +1,51 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_SAMPLE_RENF_ELEM_APPROXIMATION_HPP
+#define LIBINTERVALXT_SAMPLE_RENF_ELEM_APPROXIMATION_HPP
+
+#include <e-antic/renf_elem.h>
+#include <e-antic/renfxx.h>
+
+#include "approximation.hpp"
+
+namespace intervalxt::sample {
+
+namespace {
+
+template <>
+struct Approximation<eantic::renf_elem_class> {
+  using T = eantic::renf_elem_class;
+
+  Enclosure operator()(const T& x) {
+    // e-antic refines the embedding of x in place (which does not change its
+    // value) to round correctly.
+    auto* element = const_cast<::renf_elem_struct*>(x.renf_elem_t());
+    auto* parent = const_cast<::renf_struct*>(x.parent().renf_t());
+    return Enclosure(
+        renf_elem_get_d(element, parent, ARF_RND_FLOOR),
+        renf_elem_get_d(element, parent, ARF_RND_CEIL));
+  }
+};
+
+}  // namespace
+
+}  // namespace intervalxt::sample
+
+#endif
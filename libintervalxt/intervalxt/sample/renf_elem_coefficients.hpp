@@ -23,6 +23,9 @@
 
 #include <e-antic/renfxx.h>
 
+#include <algorithm>
+#include <optional>
+
 #include "coefficients.hpp"
 
 namespace intervalxt::sample {
@@ -33,23 +36,37 @@ template <>
 struct Coefficients<eantic::renf_elem_class> {
   using T = eantic::renf_elem_class;
 
+  // The coefficients of a subset of elements are computed with respect to
+  // the same number field unless they are rational, in which case the
+  // coefficients have a different length.
+  static constexpr bool incremental = true;
+
   std::vector<std::vector<mpq_class>> operator()(const std::vector<T>& elements) {
     if (elements.size() == 0)
       return {};
 
-    const auto* parent = &elements[0].parent();
-    for (auto& x : elements) {
-      if (x.is_rational())
-        continue;
-      if (parent->degree() == 1)
-        parent = &x.parent();
-      if (*parent != x.parent())
-        throw std::logic_error("not implemented: cannot coerce elements living in different number fields to a common parent yet");
+    // Usually, all elements live in the same parent as in the previous call.
+    // Then we do not need to search for a common parent nor coerce.
+    const bool coerce = std::any_of(begin(elements), end(elements), [&](const auto& x) { return &x.parent() != parent; });
+
+    if (coerce) {
+      parent = &elements[0].parent();
+      for (auto& x : elements) {
+        if (x.is_rational())
+          continue;
+        if (parent->degree() == 1)
+          parent = &x.parent();
+        if (*parent != x.parent())
+          throw std::logic_error("not implemented: cannot coerce elements living in different number fields to a common parent yet");
+      }
     }
 
     std::vector<std::vector<mpq_class>> ret;
-    for (auto x : elements) {
-      x = eantic::renf_elem_class(*parent, x);
+    for (const auto& element : elements) {
+      std::optional<T> coerced;
+      if (&element.parent() != parent)
+        coerced = eantic::renf_elem_class(*parent, element);
+      const auto& x = coerced ? *coerced : element;
 
       std::vector<mpq_class> coefficients;
       const auto den = x.den();
@@ -64,6 +81,12 @@ struct Coefficients<eantic::renf_elem_class> {
 
     return ret;
   }
+
+ private:
+  // The common parent of the elements of the last call.
+  // This pointer is only used to compare with the parents of the elements
+  // of the next call; it is never dereferenced when it might be dangling.
+  const eantic::renf_class* parent = nullptr;
 };
 
 }  // namespace
@@ -23,6 +23,7 @@
 
 #include <e-antic/renfxx.h>
 
+#include "renf_elem_approximation.hpp"
 #include "floor_division.hpp"
 
 namespace intervalxt::sample {
@@ -34,6 +35,10 @@ struct FloorDivision<eantic::renf_elem_class> {
   using T = eantic::renf_elem_class;
 
   mpz_class operator()(const T& divident, const T& divisor) {
+    // An exact floor division is expensive, so we first try to guess the
+    // quotient from floating point approximations.
+    if (const auto quotient = approximateFloorDivision(divident, divisor))
+      return *quotient;
     return divident.floordiv(divisor);
   }
 };
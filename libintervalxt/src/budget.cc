@@ -0,0 +1,119 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#include "../intervalxt/budget.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+
+#include "impl/budget.impl.hpp"
+
+namespace intervalxt {
+
+Budget::Budget() :
+  Budget(std::optional<Clock::time_point>{}) {}
+
+Budget::Budget(std::optional<Clock::time_point> deadline, std::optional<size_t> steps) :
+  self(std::make_shared<ImplementationOf<Budget>>(deadline, steps)) {}
+
+Budget::Budget(Clock::duration timeout, std::optional<size_t> steps) :
+  Budget(Clock::now() + timeout, steps) {}
+
+void Budget::cancel() {
+  self->cancelled = true;
+}
+
+bool Budget::cancelled() const {
+  return self->cancelled.load(std::memory_order_relaxed);
+}
+
+bool Budget::exhausted() const {
+  if (cancelled())
+    return true;
+
+  if (self->deadline && Clock::now() >= *self->deadline)
+    return true;
+
+  return self->limited && self->steps.load(std::memory_order_relaxed) <= 0;
+}
+
+std::optional<Budget::Clock::time_point> Budget::deadline() const {
+  return self->deadline;
+}
+
+std::optional<size_t> Budget::steps() const {
+  if (!self->limited)
+    return std::nullopt;
+
+  return static_cast<size_t>(std::max<int64_t>(0, self->steps.load(std::memory_order_relaxed)));
+}
+
+bool Budget::operator==(const Budget& rhs) const {
+  return self == rhs.self;
+}
+
+ImplementationOf<Budget>::ImplementationOf(std::optional<Budget::Clock::time_point> deadline, std::optional<size_t> steps) :
+  deadline(deadline),
+  limited(steps.has_value()),
+  steps(static_cast<int64_t>(std::min<size_t>(steps.value_or(0), std::numeric_limits<int64_t>::max()))) {}
+
+const Budget& ImplementationOf<Budget>::unlimited() {
+  static const Budget unlimited;
+  return unlimited;
+}
+
+bool ImplementationOf<Budget>::spend(const Budget& budget) {
+  auto& self = *budget.self;
+
+  if (self.cancelled.load(std::memory_order_relaxed))
+    return false;
+
+  if (self.deadline && Budget::Clock::now() >= *self.deadline)
+    return false;
+
+  if (self.limited && self.steps.fetch_sub(1, std::memory_order_relaxed) <= 0)
+    return false;
+
+  return true;
+}
+
+std::ostream& operator<<(std::ostream& os, const Budget& self) {
+  os << "Budget(";
+
+  bool first = true;
+  const auto separate = [&]() -> std::ostream& {
+    if (!first) os << ", ";
+    first = false;
+    return os;
+  };
+
+  if (const auto deadline = self.deadline())
+    separate() << "deadline in " << std::chrono::duration_cast<std::chrono::milliseconds>(*deadline - Budget::Clock::now()).count() << "ms";
+  if (const auto steps = self.steps())
+    separate() << *steps << " steps";
+  if (self.cancelled())
+    separate() << "cancelled";
+
+  return os << ")";
+}
+
+}  // namespace intervalxt
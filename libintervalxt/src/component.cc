@@ -24,28 +24,193 @@
 #include <fmt/ranges.h>
 
 #include <boost/logic/tribool.hpp>
+#include <list>
+#include <mutex>
 #include <ostream>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "../intervalxt/budget.hpp"
 #include "../intervalxt/decomposition_step.hpp"
 #include "../intervalxt/fmt.hpp"
 #include "../intervalxt/induction_step.hpp"
 #include "../intervalxt/label.hpp"
-#include "external/rx-ranges/include/rx/ranges.hpp"
+#include "impl/budget.impl.hpp"
 #include "impl/component.impl.hpp"
 #include "impl/connection.impl.hpp"
 #include "impl/decomposition_state.hpp"
 #include "impl/dynamical_decomposition.impl.hpp"
 #include "impl/half_edge.impl.hpp"
 #include "impl/implementation_of_decomposition.hpp"
+#include "impl/interval_exchange_transformation.impl.hpp"
 #include "impl/separatrix.impl.hpp"
 #include "util/assert.ipp"
 
 namespace intervalxt {
 
+namespace {
+
+using Part = ImplementationOf<Component::Sides::iterator>::Part;
+using Slot = ImplementationOf<Component::Sides::iterator>::Slot;
+using Position = ImplementationOf<Component::Sides::iterator>::Position;
+using Connections = PooledList<DecompositionState::Connection>;
+
+// Return the interval that follows edge in its contour or nullptr if there is
+// no such interval.
+const Interval* following(const std::list<Interval>& contour, const Interval* edge) {
+  auto next = std::list<Interval>::const_iterator(edge->twin->twin);
+  return ++next == contour.end() ? nullptr : &*next;
+}
+
+// Return the interval that precedes edge in its contour or nullptr if there
+// is no such interval.
+const Interval* preceding(const std::list<Interval>& contour, const Interval* edge) {
+  auto previous = std::list<Interval>::const_iterator(edge->twin->twin);
+  return previous == contour.begin() ? nullptr : &*--previous;
+}
+
+// Walks the perimeter of a component (or a portion thereof) without creating
+// any intermediate containers.
+class Walk {
+ public:
+  Walk(const ImplementationOf<Component>& component, Part end) :
+    component(component),
+    top(component.contour(true)),
+    bottom(component.contour(false)),
+    end(end) {}
+
+  // Return the position of the first side of the given part.
+  Position begin(Part part) const { return settle(start(part)); }
+
+  // Return the position of the side following position.
+  Position next(Position position) const {
+    if (position.slot != Slot::EDGE) {
+      const auto [connections, reversed] = run(position);
+      if (reversed) {
+        if (position.connection != connections->begin()) {
+          --position.connection;
+          return position;
+        }
+      } else {
+        if (++position.connection != connections->end())
+          return position;
+      }
+    }
+
+    return settle(advance(position));
+  }
+
+  // Return the side at position.
+  Side side(const Position& position) const {
+    if (position.slot == Slot::EDGE)
+      return ImplementationOf<HalfEdge>::make(component.decomposition, component.component, *position.edge, position.part == Part::TOP ? ImplementationOf<HalfEdge>::Contour::TOP : ImplementationOf<HalfEdge>::Contour::BOTTOM);
+    return ImplementationOf<Connection>::make(component.decomposition, *position.connection);
+  }
+
+ private:
+  // Return the position at the very beginning of part (which might not be
+  // the position of a side.)
+  Position start(Part part) const {
+    if (part >= end)
+      return {};
+
+    switch (part) {
+      case Part::BOTTOM:
+        return {part, Slot::BEFORE, &bottom.front()};
+      case Part::TOP:
+        return {part, Slot::BEFORE, &top.back()};
+      default:
+        return {part, Slot::BEFORE, nullptr};
+    }
+  }
+
+  // Return the connections that are walked at position and whether they are
+  // walked in reverse; or nullptr if there are no such connections.
+  std::pair<const Connections*, bool> run(const Position& position) const {
+    const bool before = position.slot == Slot::BEFORE;
+
+    switch (position.part) {
+      case Part::BOTTOM:
+        if (before && position.edge != &bottom.front())
+          return {&component.connections(*position.edge).bottomLeft, true};
+        if (!before && position.edge != &bottom.back())
+          return {&component.connections(*position.edge).bottomRight, false};
+        break;
+      case Part::RIGHT:
+        if (before)
+          return {&component.connections(bottom.back()).bottomRight, false};
+        return {&component.connections(top.back()).topRight, false};
+      case Part::TOP:
+        if (before && position.edge != &top.back())
+          return {&component.connections(*position.edge).topRight, false};
+        if (!before && position.edge != &top.front())
+          return {&component.connections(*position.edge).topLeft, true};
+        break;
+      case Part::LEFT:
+        if (before)
+          return {&component.connections(top.front()).topLeft, true};
+        return {&component.connections(bottom.front()).bottomLeft, true};
+      default:
+        break;
+    }
+
+    return {nullptr, false};
+  }
+
+  // Return the position at the beginning of the slot following position
+  // (which might not be the position of a side.)
+  Position advance(Position position) const {
+    position.connection = {};
+
+    if (position.slot != Slot::AFTER) {
+      position.slot = static_cast<Slot>(static_cast<int>(position.slot) + 1);
+      return position;
+    }
+
+    const Interval* edge = nullptr;
+    if (position.part == Part::BOTTOM)
+      edge = following(bottom, position.edge);
+    else if (position.part == Part::TOP)
+      edge = preceding(top, position.edge);
+
+    if (edge != nullptr)
+      return {position.part, Slot::BEFORE, edge};
+
+    return start(static_cast<Part>(static_cast<int>(position.part) + 1));
+  }
+
+  // Return the first position of a side at or after position.
+  Position settle(Position position) const {
+    while (position.part != Part::END) {
+      if (position.slot == Slot::EDGE) {
+        if (position.edge != nullptr)
+          return position;
+      } else {
+        const auto [connections, reversed] = run(position);
+        if (connections != nullptr && !connections->empty()) {
+          position.connection = reversed ? --connections->end() : connections->begin();
+          return position;
+        }
+      }
+
+      position = advance(position);
+    }
+
+    return {};
+  }
+
+  const ImplementationOf<Component>& component;
+  const std::list<Interval>& top;
+  const std::list<Interval>& bottom;
+  const Part end;
+};
+
+}  // namespace
+
 std::vector<Side> Component::perimeter() const {
-  auto perimeter = rx::chain(bottom(), right(), top(), left()) | rx::to_vector();
+  const auto sides = perimeterView();
+  auto perimeter = std::vector<Side>(sides.begin(), sides.end());
 
   LIBINTERVALXT_ASSERT(std::unordered_set<Side>(begin(perimeter), end(perimeter)).size() == perimeter.size(), "Perimeter must not contain duplicates.");
 
@@ -53,29 +218,43 @@ std::vector<Side> Component::perimeter() const {
 }
 
 std::vector<Side> Component::left() const {
-  const auto& iet = self->component->iet;
-  const bool swapped = iet.swapped();
-  return rx::chain(
-             self->connections(*begin(swapped ? iet.top() : iet.bottom())).bottomLeft,
-             self->connections(*begin(swapped ? iet.bottom() : iet.top())).topLeft) |
-         rx::transform([&](const auto& connection) { return Side(ImplementationOf<Connection>::make(self->decomposition, connection)); }) | rx::reverse() | rx::to_vector();
+  const auto sides = leftView();
+  return std::vector<Side>(sides.begin(), sides.end());
 }
 
 std::vector<Side> Component::right() const {
-  const auto& iet = self->component->iet;
-  const bool swapped = iet.swapped();
-  return rx::chain(
-             self->connections(*rbegin(swapped ? iet.top() : iet.bottom())).bottomRight,
-             self->connections(*rbegin(swapped ? iet.bottom() : iet.top())).topRight) |
-         rx::transform([&](const auto& connection) { return Side(ImplementationOf<Connection>::make(self->decomposition, connection)); }) | rx::to_vector();
+  const auto sides = rightView();
+  return std::vector<Side>(sides.begin(), sides.end());
 }
 
 std::vector<Side> Component::bottom() const {
-  return ImplementationOf<Component>::horizontal(*this, false);
+  const auto sides = bottomView();
+  return std::vector<Side>(sides.begin(), sides.end());
 }
 
 std::vector<Side> Component::top() const {
-  return ImplementationOf<Component>::horizontal(*this, true);
+  const auto sides = topView();
+  return std::vector<Side>(sides.begin(), sides.end());
+}
+
+Component::Sides Component::perimeterView() const {
+  return Sides(*this, static_cast<int>(Part::BOTTOM), static_cast<int>(Part::END));
+}
+
+Component::Sides Component::leftView() const {
+  return Sides(*this, static_cast<int>(Part::LEFT), static_cast<int>(Part::END));
+}
+
+Component::Sides Component::rightView() const {
+  return Sides(*this, static_cast<int>(Part::RIGHT), static_cast<int>(Part::TOP));
+}
+
+Component::Sides Component::bottomView() const {
+  return Sides(*this, static_cast<int>(Part::BOTTOM), static_cast<int>(Part::RIGHT));
+}
+
+Component::Sides Component::topView() const {
+  return Sides(*this, static_cast<int>(Part::TOP), static_cast<int>(Part::LEFT));
 }
 
 boost::logic::tribool Component::cylinder() const {
@@ -91,11 +270,21 @@ boost::logic::tribool Component::keane() const {
 }
 
 std::vector<HalfEdge> Component::topContour() const {
-  return (self->component->iet.swapped() ? self->component->iet.bottom() : self->component->iet.top()) | rx::transform([&](const auto& label) { return topContour(label); }) | rx::to_vector();
+  const auto halfEdges = topContourView();
+  return std::vector<HalfEdge>(halfEdges.begin(), halfEdges.end());
+}
+
+Component::HalfEdges Component::topContourView() const {
+  return HalfEdges(*this, true);
 }
 
 std::vector<HalfEdge> Component::bottomContour() const {
-  return (self->component->iet.swapped() ? self->component->iet.top() : self->component->iet.bottom()) | rx::transform([&](const auto& label) { return bottomContour(label); }) | rx::to_vector();
+  const auto halfEdges = bottomContourView();
+  return std::vector<HalfEdge>(halfEdges.begin(), halfEdges.end());
+}
+
+Component::HalfEdges Component::bottomContourView() const {
+  return HalfEdges(*this, false);
 }
 
 HalfEdge Component::topContour(Label label) const {
@@ -113,7 +302,7 @@ bool Component::operator==(const Component& rhs) const {
 std::pair<std::list<Connection>, std::list<Connection>> Component::inject(const HalfEdge& at, const std::vector<std::pair<Label, Label>>& left_, const std::vector<std::pair<Label, Label>>& right_) {
   using Orientation = DecompositionState::Separatrix::Orientation;
 
-  ImplementationOf<DynamicalDecomposition>::check(self->decomposition);
+  ImplementationOf<DynamicalDecomposition>::check(self->decomposition, at);
 
   const bool top = at.top();
 
@@ -158,14 +347,26 @@ std::pair<std::list<Connection>, std::list<Connection>> Component::inject(const
     if (top) std::reverse(begin(rightInjected), end(rightInjected));
   }
 
-  ImplementationOf<DynamicalDecomposition>::check(self->decomposition);
+  ImplementationOf<DynamicalDecomposition>::check(self->decomposition, at);
 
   return {leftInjected, rightInjected};
 }
 
 DecompositionStep Component::decompositionStep(int limit) {
+  return decompositionStep(limit, true);
+}
+
+DecompositionStep Component::decompositionStep(int limit, bool equivalent) {
+  return decompositionStep(ImplementationOf<Budget>::unlimited(), limit, equivalent);
+}
+
+DecompositionStep Component::decompositionStep(const Budget& budget, int limit, bool equivalent) {
   LIBINTERVALXT_ASSERT(!cylinder() || !keane(), "Component " << *this << " is already fully decomposed.");
 
+  // No induction is in progress here, so this is a good time to serve a
+  // pending snapshot() of the decomposition.
+  ImplementationOf<DynamicalDecomposition>::publish(self->decomposition);
+
   auto& component = *self->component;
 
   const std::optional<int> boshernitzanCost = ImplementationOf<Component>::boshernitzanCost(component.iet);
@@ -173,9 +374,9 @@ DecompositionStep Component::decompositionStep(int limit) {
   if (limit == -1) {
     limit = 0;
     while (true) {
-      auto step = decompositionStep(limit);
+      auto step = decompositionStep(budget, limit, equivalent);
 
-      if (step.result != DecompositionStep::Result::LIMIT_REACHED)
+      if (step.result != DecompositionStep::Result::LIMIT_REACHED || budget.exhausted())
         return step;
 
       limit = boshernitzanCost.value_or(2 * (limit + 1));
@@ -198,8 +399,19 @@ DecompositionStep Component::decompositionStep(int limit) {
 
     limit -= zorichInductionSteps;
 
-    step = component.iet.induce(zorichInductionSteps);
-  } while (step.result == InductionStep::Result::LIMIT_REACHED && limit != 0);
+    step = component.iet.induce(budget, zorichInductionSteps);
+
+    // Other components might be decomposed concurrently, see
+    // DynamicalDecomposition::decompose(). The induction above only touched
+    // this component but its connections live in the shared state.
+    std::lock_guard<std::mutex> lock(self->state().mutex);
+
+    ImplementationOf<IntervalExchangeTransformation>::drain(component.iet, [&](const auto& subtraction) {
+      self->subtract(subtraction.minuend, subtraction.subtrahend, subtraction.minuendOnTop);
+    });
+  } while (step.result == InductionStep::Result::LIMIT_REACHED && limit != 0 && !budget.exhausted());
+
+  std::lock_guard<std::mutex> lock(self->state().mutex);
 
   switch (step.result) {
     case InductionStep::Result::LIMIT_REACHED:
@@ -214,7 +426,9 @@ DecompositionStep Component::decompositionStep(int limit) {
     case InductionStep::Result::SEPARATING_CONNECTION: {
       auto [b, t] = *step.connection;
 
-      auto equivalent = self->walkClockwise(-ImplementationOf<HalfEdge>::make(self->decomposition, self->component, *rbegin(bottomContour()), ImplementationOf<HalfEdge>::Contour::TOP), ImplementationOf<HalfEdge>::make(self->decomposition, self->component, *rbegin(topContour()), ImplementationOf<HalfEdge>::Contour::TOP));
+      std::optional<std::list<Side>> walk;
+      if (equivalent)
+        walk = self->walkClockwise(-ImplementationOf<HalfEdge>::make(self->decomposition, self->component, *rbegin(bottomContour()), ImplementationOf<HalfEdge>::Contour::TOP), ImplementationOf<HalfEdge>::make(self->decomposition, self->component, *rbegin(topContour()), ImplementationOf<HalfEdge>::Contour::TOP));
 
       auto connection = DecompositionState::Connection{
           ImplementationOf<Separatrix>::makeAtBottom(self->decomposition, b),
@@ -223,7 +437,7 @@ DecompositionStep Component::decompositionStep(int limit) {
       return {
           DecompositionStep::Result::SEPARATING_CONNECTION,
           ImplementationOf<Connection>::make(self->decomposition, connection),
-          equivalent,
+          std::move(walk),
           right};
     }
     case InductionStep::Result::NON_SEPARATING_CONNECTION: {
@@ -231,16 +445,19 @@ DecompositionStep Component::decompositionStep(int limit) {
       auto [b, t] = *step.connection;
       LIBINTERVALXT_ASSERT(b != t, "Mistook cylinder for a non-separating connection");
 
-      // t is not valid anymore but we can still use cross() on it.
-      auto equivalent = ImplementationOf<HalfEdge>::make(self->decomposition, self->component, t, ImplementationOf<HalfEdge>::Contour::TOP).cross();
-      equivalent.splice(end(equivalent), (-ImplementationOf<HalfEdge>::make(self->decomposition, self->component, b, ImplementationOf<HalfEdge>::Contour::TOP)).cross());
-      std::reverse(begin(equivalent), end(equivalent));
-      for (auto& side : equivalent) {
-        if (auto connection = std::get_if<intervalxt::Connection>(&side)) {
-          side = -*connection;
-        } else {
-          // This should probably change with #68.
-          ;
+      std::optional<std::list<Side>> walk;
+      if (equivalent) {
+        // t is not valid anymore but we can still use cross() on it.
+        walk = ImplementationOf<HalfEdge>::make(self->decomposition, self->component, t, ImplementationOf<HalfEdge>::Contour::TOP).cross();
+        walk->splice(end(*walk), (-ImplementationOf<HalfEdge>::make(self->decomposition, self->component, b, ImplementationOf<HalfEdge>::Contour::TOP)).cross());
+        std::reverse(begin(*walk), end(*walk));
+        for (auto& side : *walk) {
+          if (auto connection = std::get_if<intervalxt::Connection>(&side)) {
+            side = -*connection;
+          } else {
+            // This should probably change with #68.
+            ;
+          }
         }
       }
 
@@ -272,7 +489,7 @@ DecompositionStep Component::decompositionStep(int limit) {
       return {
           DecompositionStep::Result::NON_SEPARATING_CONNECTION,
           ImplementationOf<Connection>::make(self->decomposition, connection),
-          equivalent};
+          std::move(walk)};
     }
     case InductionStep::Result::WITHOUT_PERIODIC_TRAJECTORY_BOSHERNITZAN:
       component.withoutPeriodicTrajectory = true;
@@ -291,37 +508,9 @@ ImplementationOf<Component>::ImplementationOf(const DynamicalDecomposition& deco
   ImplementationOfDecomposition(decomposition),
   component(component) {}
 
-std::vector<Side> ImplementationOf<Component>::horizontal(const Component& component, bool top) {
-  std::vector<Side> contour;
-
-  const auto add = [&](const auto& connection) {
-    assert(not contour.empty());
-    contour.push_back(ImplementationOf<Connection>::make(component.self->decomposition, connection));
-  };
-
-  auto halfEdges = top ? component.topContour() : component.bottomContour();
-
-  for (auto edge = begin(halfEdges); edge != end(halfEdges); edge++) {
-    if (edge != begin(halfEdges)) {
-      if (top)
-        component.self->connections(*edge).topLeft | rx::for_each(add);
-      else
-        component.self->connections(*edge).bottomLeft | rx::reverse() | rx::for_each(add);
-    }
-
-    contour.push_back(*edge);
-
-    if (edge != --end(halfEdges)) {
-      if (top)
-        component.self->connections(*edge).topRight | rx::reverse() | rx::for_each(add);
-      else
-        component.self->connections(*edge).bottomRight | rx::for_each(add);
-    }
-  }
-
-  if (top) std::reverse(contour.begin(), contour.end());
-
-  return contour;
+const std::list<Interval>& ImplementationOf<Component>::contour(bool top) const {
+  const auto& iet = ImplementationOf<IntervalExchangeTransformation>::self(component->iet);
+  return top != iet.swap ? iet.top : iet.bottom;
 }
 
 Component ImplementationOf<Component>::make(const DynamicalDecomposition& decomposition, DecompositionState::Component* component) {
@@ -356,6 +545,26 @@ std::optional<int> ImplementationOf<Component>::boshernitzanCost(const IntervalE
   return 64;
 }
 
+void ImplementationOf<Component>::subtract(Label minuend, Label subtrahend, bool minuendOnTop) {
+  // Normalize top and bottom such that the minuend is on top and the
+  // subtrahend on the bottom.
+  auto& subtrahendHalfEdges = connections(subtrahend);
+  auto& minuendHalfEdges = connections(minuend);
+
+  // The subtrahend takes the minuends top (left) list with it (this might be a
+  // nop since bottom and top share this initial list of connections.)
+  auto& bottomSubtrahend = minuendOnTop ? subtrahendHalfEdges.bottomLeft : subtrahendHalfEdges.topLeft;
+  auto& topMinuend = minuendOnTop ? minuendHalfEdges.topLeft : minuendHalfEdges.bottomLeft;
+  auto& bottomMinuend = minuendOnTop ? minuendHalfEdges.bottomLeft : minuendHalfEdges.topLeft;
+
+  bottomSubtrahend.splice(minuendOnTop ? end(bottomSubtrahend) : begin(bottomSubtrahend), topMinuend);
+
+  // The subtrahend takes the minuends bottom left list.
+  bottomSubtrahend.splice(
+      minuendOnTop ? end(bottomSubtrahend) : begin(bottomSubtrahend),
+      bottomMinuend);
+}
+
 // It would be easier to always walk counterclockwise as that is compatible with the order in cross(), see #69.
 std::list<Side> ImplementationOf<Component>::walkClockwise(HalfEdge from, HalfEdge to) const {
   LIBINTERVALXT_ASSERT(from.component() == to.component(), "Cannot walk between components");
@@ -443,10 +652,16 @@ std::optional<HalfEdge> ImplementationOf<Component>::previous(DecompositionState
 }
 
 bool Component::decompose(std::function<bool(const Component&)> target, int limit) {
+  return decompose(ImplementationOf<Budget>::unlimited(), target, limit);
+}
+
+bool Component::decompose(const Budget& budget, std::function<bool(const Component&)> target, int limit) {
   bool limitReached = false;
 
   while (!target(*this)) {
-    auto step = decompositionStep(limit);
+    // The equivalent paths of connections are never reported to the caller
+    // so we do not compute them.
+    auto step = decompositionStep(budget, limit, false);
 
     if (step.result == DecompositionStep::Result::LIMIT_REACHED) {
       limitReached = true;
@@ -458,9 +673,12 @@ bool Component::decompose(std::function<bool(const Component&)> target, int limi
       // Note that we do this even if another such component failed to reach
       // that target for some types of searches this might be not be desirable
       // and we would prefer to globally abort the search. But this is currently not implemented.
-      limitReached = !step.additionalComponent->decompose(target, limit) || limitReached;
+      limitReached = !step.additionalComponent->decompose(budget, target, limit) || limitReached;
     }
   }
+
+  ImplementationOf<DynamicalDecomposition>::publish(self->decomposition);
+
   return not limitReached;
 }
 
@@ -469,6 +687,85 @@ IntervalExchangeTransformation Component::iet() const {
   return IntervalExchangeTransformation(std::make_shared<Lengths>(self->component->iet.lengths()->forget()), iet.top(), iet.bottom());
 }
 
+Component::HalfEdges::HalfEdges(const Component& component, bool top) :
+  component(component),
+  top(top) {}
+
+Component::HalfEdges::iterator Component::HalfEdges::begin() const {
+  return ImplementationOf<iterator>::make(component, top, &component.self->contour(top).front());
+}
+
+Component::HalfEdges::iterator Component::HalfEdges::end() const {
+  return ImplementationOf<iterator>::make(component, top, nullptr);
+}
+
+HalfEdge Component::HalfEdges::iterator::operator*() const {
+  return ImplementationOf<HalfEdge>::make(component.self->decomposition, component.self->component, *self->interval, self->top ? ImplementationOf<HalfEdge>::Contour::TOP : ImplementationOf<HalfEdge>::Contour::BOTTOM);
+}
+
+Component::HalfEdges::iterator& Component::HalfEdges::iterator::operator++() {
+  self->interval = following(component.self->contour(self->top), self->interval);
+  return *this;
+}
+
+Component::HalfEdges::iterator Component::HalfEdges::iterator::operator++(int) {
+  auto ret = *this;
+  ++*this;
+  return ret;
+}
+
+bool Component::HalfEdges::iterator::operator==(const iterator& rhs) const {
+  return component == rhs.component && self->top == rhs.self->top && self->interval == rhs.self->interval;
+}
+
+Component::Sides::Sides(const Component& component, int first, int last) :
+  component(component),
+  first(first),
+  last(last) {}
+
+Component::Sides::iterator Component::Sides::begin() const {
+  return ImplementationOf<iterator>::make(component, static_cast<Part>(last), Walk(*component.self, static_cast<Part>(last)).begin(static_cast<Part>(first)));
+}
+
+Component::Sides::iterator Component::Sides::end() const {
+  return ImplementationOf<iterator>::make(component, static_cast<Part>(last), Position{});
+}
+
+Side Component::Sides::iterator::operator*() const {
+  return Walk(*component.self, self->last).side(self->position);
+}
+
+Component::Sides::iterator& Component::Sides::iterator::operator++() {
+  self->position = Walk(*component.self, self->last).next(self->position);
+  return *this;
+}
+
+Component::Sides::iterator Component::Sides::iterator::operator++(int) {
+  auto ret = *this;
+  ++*this;
+  return ret;
+}
+
+bool Component::Sides::iterator::operator==(const iterator& rhs) const {
+  return component == rhs.component && self->position == rhs.self->position;
+}
+
+ImplementationOf<Component::HalfEdges::iterator>::ImplementationOf(bool top, const Interval* interval) :
+  top(top),
+  interval(interval) {}
+
+Component::HalfEdges::iterator ImplementationOf<Component::HalfEdges::iterator>::make(const Component& component, bool top, const Interval* interval) {
+  return Component::HalfEdges::iterator(PrivateConstructor{}, component, top, interval);
+}
+
+ImplementationOf<Component::Sides::iterator>::ImplementationOf(Part last, Position position) :
+  last(last),
+  position(position) {}
+
+Component::Sides::iterator ImplementationOf<Component::Sides::iterator>::make(const Component& component, Part last, Position position) {
+  return Component::Sides::iterator(PrivateConstructor{}, component, last, position);
+}
+
 std::ostream& operator<<(std::ostream& os, const Component& self) {
   return os << fmt::format("{}", fmt::join(self.perimeter(), " "));
 }
@@ -23,22 +23,32 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <deque>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "../intervalxt/budget.hpp"
 #include "../intervalxt/component.hpp"
 #include "../intervalxt/connection.hpp"
+#include "../intervalxt/decomposition_step.hpp"
 #include "../intervalxt/fmt.hpp"
 #include "../intervalxt/interval_exchange_transformation.hpp"
 #include "../intervalxt/label.hpp"
 #include "external/rx-ranges/include/rx/ranges.hpp"
+#include "impl/budget.impl.hpp"
 #include "impl/component.impl.hpp"
 #include "impl/decomposition_state.hpp"
 #include "impl/dynamical_decomposition.impl.hpp"
 #include "impl/interval_exchange_transformation.impl.hpp"
-#include "impl/lengths_with_connections.hpp"
+#include "impl/work_stealing_pool.hpp"
 #include "util/assert.ipp"
 
 namespace intervalxt {
@@ -49,11 +59,11 @@ DynamicalDecomposition::DynamicalDecomposition(const IntervalExchangeTransformat
       IntervalExchangeTransformation(
           ImplementationOf<IntervalExchangeTransformation>::withLengths(iet,
               [&](std::shared_ptr<Lengths> original) -> std::shared_ptr<Lengths> {
-                return std::make_shared<Lengths>(LengthsWithConnections(original, self));
+                return original;
               })));
 
   for (auto label : iet.top())
-    self->decomposition.connections[label];
+    self->decomposition.insertConnections(label);
 }
 
 std::vector<Component> DynamicalDecomposition::components() const {
@@ -64,8 +74,87 @@ std::vector<Component> DynamicalDecomposition::components() const {
 }
 
 bool DynamicalDecomposition::decompose(std::function<bool(const Component&)> target, int limit) {
+  return decompose(target, limit, 1);
+}
+
+bool DynamicalDecomposition::decompose(std::function<bool(const Component&)> target, int limit, unsigned int threads) {
+  return decompose(ImplementationOf<Budget>::unlimited(), target, limit, threads);
+}
+
+bool DynamicalDecomposition::decompose(const Budget& budget, std::function<bool(const Component&)> target, int limit, unsigned int threads) {
   auto components = this->components();
-  return std::all_of(components.begin(), components.end(), [&](auto& component) { return component.decompose(target, limit); });
+
+  if (threads == 1) {
+    const bool decomposed = std::all_of(components.begin(), components.end(), [&](auto& component) { return component.decompose(budget, target, limit); });
+    self->publish(*this, true);
+    return decomposed;
+  }
+
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+
+  // Components split off by a separating connection are independent, so we
+  // decompose each component in its own task. Component::decompositionStep()
+  // takes care of locking the state shared between components.
+  auto& mutex = self->decomposition.mutex;
+  std::atomic<bool> limitReached = false;
+
+  WorkStealingPool pool(threads);
+
+  std::function<void(Component)> decompose = [&](Component component) {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (target(component)) return;
+      }
+
+      auto step = component.decompositionStep(budget, limit, false);
+
+      if (step.result == DecompositionStep::Result::LIMIT_REACHED) {
+        limitReached = true;
+        return;
+      }
+
+      if (step.additionalComponent)
+        pool.submit([&decompose, additional = *step.additionalComponent]() { decompose(additional); });
+    }
+  };
+
+  // There is no point at which all components are in a consistent state, so
+  // we can only publish a snapshot once all threads are done.
+  self->parallel = true;
+
+  for (auto& component : components)
+    pool.submit([&decompose, component]() { decompose(component); });
+
+  try {
+    pool.wait();
+  } catch (...) {
+    self->parallel = false;
+    throw;
+  }
+
+  self->parallel = false;
+  self->publish(*this, true);
+
+  return not limitReached;
+}
+
+std::optional<DynamicalDecomposition> DynamicalDecomposition::snapshot() const {
+  self->requested = true;
+
+  std::shared_ptr<const ImplementationOf<DynamicalDecomposition>> published;
+  {
+    std::lock_guard<std::mutex> lock(self->publishedMutex);
+    published = self->published;
+  }
+
+  if (!published)
+    return std::nullopt;
+
+  // Every reader gets its own copy since readers might modify their
+  // snapshot, e.g., decompose it further.
+  return DynamicalDecomposition(PrivateConstructor{}, ImplementationOf<DynamicalDecomposition>::clone(*published));
 }
 
 bool DynamicalDecomposition::operator==(const DynamicalDecomposition& rhs) const {
@@ -76,6 +165,7 @@ ImplementationOf<DynamicalDecomposition>::ImplementationOf() {}
 
 Component ImplementationOf<DynamicalDecomposition>::insertComponent(DynamicalDecomposition& decomposition, IntervalExchangeTransformation&& iet) {
   auto& state = self(decomposition).decomposition.components.emplace_back(DecompositionState::Component{std::move(iet)});
+  ImplementationOf<IntervalExchangeTransformation>::record(state.iet);
   return ImplementationOf<Component>::make(decomposition, &state);
 }
 
@@ -85,28 +175,45 @@ Component ImplementationOf<DynamicalDecomposition>::insertComponent(DynamicalDec
   return right;
 }
 
-void ImplementationOf<DynamicalDecomposition>::check(const DynamicalDecomposition& decomposition) {
-  std::unordered_map<Separatrix, std::vector<Connection>> connections;
-
-  for (const auto& halfEdge : self(decomposition).decomposition.connections) {
-    for (const auto& left : {halfEdge.second.topLeft, halfEdge.second.bottomLeft}) {
-      for (const auto& data : left) {
-        const auto connection = ImplementationOf<Connection>::make(decomposition, data);
-        LIBINTERVALXT_ASSERT(connection.antiparallel(), "left connection must be antiparallel, i.e., going from top to bottom");
-        connections[connection.source()].push_back(connection);
-        connections[connection.target()].push_back(connection);
-      }
+namespace {
+
+// Return the level of expensive consistency checks that has been requested at
+// runtime through the LIBINTERVALXT_DEBUG_LEVEL environment variable. At the
+// default level 0, only checks that are local to an operation are performed.
+int debugLevel() {
+  static int value = [] {
+    const auto* ptr = std::getenv("LIBINTERVALXT_DEBUG_LEVEL");
+    if (ptr == nullptr) return 0;
+    return std::atoi(ptr);
+  }();
+  return value;
+}
+
+using Connections = std::unordered_map<Separatrix, std::vector<Connection>>;
+
+// Collect the connections attached to a half edge by their separatrices and
+// verify that they are oriented correctly.
+void collect(Connections& connections, const DynamicalDecomposition& decomposition, const DecompositionState::Connections& halfEdge) {
+  for (const auto* left : {&halfEdge.topLeft, &halfEdge.bottomLeft}) {
+    for (const auto& data : *left) {
+      const auto connection = ImplementationOf<Connection>::make(decomposition, data);
+      LIBINTERVALXT_ASSERT(connection.antiparallel(), "left connection must be antiparallel, i.e., going from top to bottom");
+      connections[connection.source()].push_back(connection);
+      connections[connection.target()].push_back(connection);
     }
-    for (const auto& right : {halfEdge.second.topRight, halfEdge.second.bottomRight}) {
-      for (const auto& data : right) {
-        const auto connection = ImplementationOf<Connection>::make(decomposition, data);
-        LIBINTERVALXT_ASSERT(connection.parallel(), "right connection must be parallel, i.e., going from bottom to top");
-        connections[connection.source()].push_back(connection);
-        connections[connection.target()].push_back(connection);
-      }
+  }
+  for (const auto* right : {&halfEdge.topRight, &halfEdge.bottomRight}) {
+    for (const auto& data : *right) {
+      const auto connection = ImplementationOf<Connection>::make(decomposition, data);
+      LIBINTERVALXT_ASSERT(connection.parallel(), "right connection must be parallel, i.e., going from bottom to top");
+      connections[connection.source()].push_back(connection);
+      connections[connection.target()].push_back(connection);
     }
   }
+}
 
+// Verify that at most one connection starts and ends at each separatrix.
+void match(const Connections& connections) {
   for (const auto& [separatrix, atSeparatrix] : connections) {
     LIBINTERVALXT_ASSERT(atSeparatrix.size() <= 2, "Only a single connection may begin at separatrix " << separatrix);
     if (atSeparatrix.size() == 2) {
@@ -115,6 +222,94 @@ void ImplementationOf<DynamicalDecomposition>::check(const DynamicalDecompositio
   }
 }
 
+}  // namespace
+
+void ImplementationOf<DynamicalDecomposition>::check(const DynamicalDecomposition& decomposition) {
+  Connections connections;
+
+  for (const auto& halfEdge : self(decomposition).decomposition.records)
+    collect(connections, decomposition, halfEdge);
+
+  match(connections);
+}
+
+void ImplementationOf<DynamicalDecomposition>::check(const DynamicalDecomposition& decomposition, Label label) {
+  if (noassert()) return;
+
+  if (debugLevel() >= 1) {
+    check(decomposition);
+    return;
+  }
+
+  const auto& state = self(decomposition).decomposition;
+
+  // Verify the connections attached to label together with the connections
+  // attached to the labels of the separatrices they start or end at, so that
+  // a connection of label clashing with a connection at an adjacent label is
+  // detected. A clash between connections that are attached to none of these
+  // labels is only detected by the full check.
+  std::unordered_set<Label> labels = {label};
+  const auto& halfEdge = state.connections(label);
+  for (const auto* side : {&halfEdge.topLeft, &halfEdge.bottomLeft, &halfEdge.topRight, &halfEdge.bottomRight}) {
+    for (const auto& connection : *side) {
+      labels.insert(connection.source.label);
+      labels.insert(connection.target.label);
+    }
+  }
+
+  Connections connections;
+  for (const auto& adjacent : labels)
+    if (state.index.find(adjacent) != state.index.end())
+      collect(connections, decomposition, state.connections(adjacent));
+  match(connections);
+}
+
+void ImplementationOf<DynamicalDecomposition>::publish(DynamicalDecomposition& decomposition, bool final) {
+  auto& self = ImplementationOf::self(decomposition);
+
+  if (self.parallel)
+    return;
+
+  const bool requested = self.requested.load(std::memory_order_relaxed) && self.requested.exchange(false);
+
+  if (!requested) {
+    if (!final)
+      return;
+
+    std::lock_guard<std::mutex> lock(self.publishedMutex);
+    if (!self.published)
+      return;
+  }
+
+  // The copy shares no mutable state with this decomposition, in particular
+  // it has its own Lengths, so the decomposing thread can go on while
+  // readers look at the copy.
+  std::shared_ptr<const ImplementationOf> copy = clone(self);
+
+  // The previous copy is released once the lock has been released.
+  std::lock_guard<std::mutex> lock(self.publishedMutex);
+  self.published.swap(copy);
+}
+
+std::shared_ptr<ImplementationOf<DynamicalDecomposition>> ImplementationOf<DynamicalDecomposition>::clone(const ImplementationOf& self) {
+  auto copy = std::make_shared<ImplementationOf>();
+  auto& state = copy->decomposition;
+
+  for (const auto& component : self.decomposition.components)
+    state.components.emplace_back(DecompositionState::Component{
+        ImplementationOf<IntervalExchangeTransformation>::clone(component.iet),
+        component.cylinder,
+        component.withoutPeriodicTrajectory,
+        component.keane});
+
+  state.pool = self.decomposition.pool;
+  for (const auto& connections : self.decomposition.records)
+    state.records.emplace_back(state.pool, connections);
+  state.index = self.decomposition.index;
+
+  return copy;
+}
+
 ImplementationOf<DynamicalDecomposition>& ImplementationOf<DynamicalDecomposition>::self(DynamicalDecomposition& self) {
   return *self.self;
 }
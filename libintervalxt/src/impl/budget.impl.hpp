@@ -0,0 +1,58 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_BUDGET_IMPL_HPP
+#define LIBINTERVALXT_BUDGET_IMPL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+#include "../../intervalxt/budget.hpp"
+
+namespace intervalxt {
+
+template <>
+class ImplementationOf<Budget> {
+ public:
+  ImplementationOf(std::optional<Budget::Clock::time_point> deadline, std::optional<size_t> steps);
+
+  // Return a budget that is never exhausted. The entry points that do not
+  // take a budget use it; it is never handed out so it cannot be cancelled.
+  static const Budget& unlimited();
+
+  // Spend a single step of budget. Return whether the budget was not
+  // exhausted yet, i.e., whether the step may be performed.
+  static bool spend(const Budget&);
+
+  const std::optional<Budget::Clock::time_point> deadline;
+
+  // Whether the number of steps is limited at all.
+  const bool limited;
+
+  // The number of steps left; this becomes negative when spend() is called
+  // on an exhausted budget.
+  std::atomic<int64_t> steps;
+
+  std::atomic<bool> cancelled = false;
+};
+
+}  // namespace intervalxt
+
+#endif
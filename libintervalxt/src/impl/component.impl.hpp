@@ -21,6 +21,8 @@
 #ifndef LIBINTERVALXT_COMPONENT_IMPL_HPP
 #define LIBINTERVALXT_COMPONENT_IMPL_HPP
 
+#include <cstdint>
+#include <list>
 #include <memory>
 
 #include "../../intervalxt/component.hpp"
@@ -29,6 +31,8 @@
 #include "connection.impl.hpp"
 #include "decomposition_state.hpp"
 #include "implementation_of_decomposition.hpp"
+#include "interval.hpp"
+#include "pooled_list.hpp"
 
 namespace intervalxt {
 
@@ -39,11 +43,19 @@ class ImplementationOf<Component> : public ImplementationOfDecomposition {
   static Component make(const DynamicalDecomposition&, DecompositionState::Component*);
 
   static std::optional<int> boshernitzanCost(const IntervalExchangeTransformation&);
-  static std::vector<Side> horizontal(const Component& component, bool top);
   static void registerSeparating(Component& left, DecompositionState::Connection, Component& right);
   static std::optional<HalfEdge> next(DecompositionState::Component*, const HalfEdge&, const DynamicalDecomposition&);
   static std::optional<HalfEdge> previous(DecompositionState::Component*, const HalfEdge&, const DynamicalDecomposition&);
 
+  // Return the intervals that make up the top (or bottom) contour of this
+  // component from left to right.
+  const std::list<Interval>& contour(bool top) const;
+
+  // Move the connections at the left of the minuend to the left of the
+  // subtrahend after zorichInduction() subtracted the subtrahend from the
+  // minuend, see ImplementationOf<IntervalExchangeTransformation>::drain().
+  void subtract(Label minuend, Label subtrahend, bool minuendOnTop);
+
   // Return the connections for walking clockwise from the counterclockwise end
   // of from to the clockwise end of to.
   std::list<Side> walkClockwise(HalfEdge from, HalfEdge to) const;
@@ -55,9 +67,76 @@ class ImplementationOf<Component> : public ImplementationOfDecomposition {
   DecompositionState::Component* component;
 };
 
+template <>
+class ImplementationOf<Component::HalfEdges::iterator> {
+ public:
+  ImplementationOf(bool top, const Interval* interval);
+  static Component::HalfEdges::iterator make(const Component&, bool top, const Interval* interval);
+
+  // Whether we are walking the top (or the bottom) contour.
+  bool top;
+  // The interval at the current position or nullptr at the end.
+  const Interval* interval;
+};
+
+template <>
+class ImplementationOf<Component::Sides::iterator> {
+ public:
+  // The portions of the perimeter of a component in the order in which
+  // perimeter() walks them.
+  enum class Part : uint8_t {
+    BOTTOM,
+    RIGHT,
+    TOP,
+    LEFT,
+    END,
+  };
+
+  // The portions of the perimeter at a single half edge of the bottom (or
+  // top) contour in the order in which they are walked. For the LEFT and
+  // RIGHT parts, BEFORE and AFTER stand for the connections attached to the
+  // two contours and there is no EDGE.
+  enum class Slot : uint8_t {
+    BEFORE,
+    EDGE,
+    AFTER,
+  };
+
+  // A position on the perimeter of a component.
+  struct Position {
+    Part part = Part::END;
+    Slot slot = Slot::BEFORE;
+    // The interval of the contour that we are currently walking along.
+    const Interval* edge = nullptr;
+    // The current connection when we are walking along connections.
+    PooledList<DecompositionState::Connection>::const_iterator connection = {};
+
+    bool operator==(const Position& rhs) const {
+      return part == rhs.part && slot == rhs.slot && edge == rhs.edge && connection == rhs.connection;
+    }
+  };
+
+  ImplementationOf(Part last, Position position);
+  static Component::Sides::iterator make(const Component&, Part last, Position position);
+
+  // The part of the perimeter at which the walk ends.
+  Part last;
+  Position position;
+};
+
 template <typename... Args>
 Component::Component(PrivateConstructor, Args&&... args) :
-  self(spimpl::make_impl<ImplementationOf<Component>>(std::forward<Args>(args)...)) {}
+  self(std::in_place, std::forward<Args>(args)...) {}
+
+template <typename... Args>
+Component::HalfEdges::iterator::iterator(PrivateConstructor, const Component& component, Args&&... args) :
+  component(component),
+  self(std::in_place, std::forward<Args>(args)...) {}
+
+template <typename... Args>
+Component::Sides::iterator::iterator(PrivateConstructor, const Component& component, Args&&... args) :
+  component(component),
+  self(std::in_place, std::forward<Args>(args)...) {}
 
 }  // namespace intervalxt
 
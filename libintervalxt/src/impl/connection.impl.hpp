@@ -43,7 +43,7 @@ class ImplementationOf<Connection> : public ImplementationOfDecomposition {
 
 template <typename... Args>
 Connection::Connection(PrivateConstructor, Args&&... args) :
-  self(spimpl::make_impl<ImplementationOf<Connection>>(std::forward<Args>(args)...)) {}
+  self(std::in_place, std::forward<Args>(args)...) {}
 
 }  // namespace intervalxt
 
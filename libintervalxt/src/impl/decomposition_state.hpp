@@ -23,10 +23,12 @@
 
 #include <boost/logic/tribool.hpp>
 #include <deque>
-#include <list>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "../../intervalxt/interval_exchange_transformation.hpp"
+#include "pooled_list.hpp"
 
 namespace intervalxt {
 
@@ -55,15 +57,51 @@ struct DecompositionState {
   };
 
   struct Connections {
-    std::list<Connection> topLeft;
-    std::list<Connection> topRight;
-    std::list<Connection> bottomLeft;
-    std::list<Connection> bottomRight;
+    explicit Connections(Pool<Connection>& pool) :
+      topLeft(pool),
+      topRight(pool),
+      bottomLeft(pool),
+      bottomRight(pool) {}
+
+    // Create a copy of other in pool which must be a copy of the pool of other.
+    Connections(Pool<Connection>& pool, const Connections& other) :
+      topLeft(pool, other.topLeft),
+      topRight(pool, other.topRight),
+      bottomLeft(pool, other.bottomLeft),
+      bottomRight(pool, other.bottomRight) {}
+
+    PooledList<Connection> topLeft;
+    PooledList<Connection> topRight;
+    PooledList<Connection> bottomLeft;
+    PooledList<Connection> bottomRight;
   };
 
+  DecompositionState() = default;
+  DecompositionState(const DecompositionState&) = delete;
+  DecompositionState& operator=(const DecompositionState&) = delete;
+
+  // Create the (initially empty) connections at label.
+  void insertConnections(const Label& label) {
+    if (index.emplace(label, records.size()).second)
+      records.emplace_back(pool);
+  }
+
+  Connections& connections(const Label& label) { return records[index.at(label)]; }
+  const Connections& connections(const Label& label) const { return records[index.at(label)]; }
+
   std::deque<Component> components;
 
-  std::unordered_map<Label, Connections> connections;
+  // The connections of all labels live in a single pool. The lists of
+  // connections attached to each label refer into this pool; they are
+  // stored in a flat vector and looked up through an index.
+  Pool<Connection> pool;
+  std::vector<Connections> records;
+  std::unordered_map<Label, size_t> index;
+
+  // Guards the components and the connections when several components are
+  // decomposed in parallel. The induction of a component's interval exchange
+  // transformation itself does not need to hold it.
+  std::mutex mutex;
 };
 
 }  // namespace intervalxt
@@ -21,8 +21,10 @@
 #ifndef LIBINTERVALXT_DYNAMICAL_DECOMPOSITION_IMPL_HPP
 #define LIBINTERVALXT_DYNAMICAL_DECOMPOSITION_IMPL_HPP
 
+#include <atomic>
 #include <deque>
 #include <memory>
+#include <mutex>
 
 #include "../../intervalxt/dynamical_decomposition.hpp"
 #include "decomposition_state.hpp"
@@ -42,14 +44,48 @@ class ImplementationOf<DynamicalDecomposition> {
   static Component insertComponent(DynamicalDecomposition&, Component& left, DecompositionState::Connection, IntervalExchangeTransformation&& right);
   static Component insertComponent(DynamicalDecomposition&, IntervalExchangeTransformation&&);
 
+  // Verify the consistency of all connections in the decomposition.
   static void check(const DynamicalDecomposition&);
+  // Verify the consistency of the connections attached to the half edges of
+  // label and of the labels whose separatrices these connections touch. If
+  // the LIBINTERVALXT_DEBUG_LEVEL environment variable is at least 1, verify
+  // the entire decomposition instead.
+  static void check(const DynamicalDecomposition&, Label);
+
+  // Publish a copy of the decomposition for snapshot() if a snapshot has
+  // been requested since the last publication. If final, publish a copy if
+  // any snapshot has been published before so that readers do not miss the
+  // final state of a decomposition. Must only be called when no component is
+  // in the middle of a decomposition step.
+  static void publish(DynamicalDecomposition&, bool final = false);
+
+  // Return a copy of the decomposition that shares no mutable state with it.
+  static std::shared_ptr<ImplementationOf> clone(const ImplementationOf&);
 
   static ImplementationOf& self(DynamicalDecomposition&);
   static const ImplementationOf& self(const DynamicalDecomposition&);
 
   DecompositionState decomposition;
+
+  // Whether components are being decomposed on several threads, i.e.,
+  // whether there are no points at which a consistent copy can be published.
+  // Atomic since it is read by the worker threads.
+  std::atomic<bool> parallel = false;
+
+  // Whether a reader is waiting for a fresh snapshot().
+  std::atomic<bool> requested = false;
+
+  // The latest copy published for snapshot(). It is never modified; readers
+  // get a clone() of it. Only accessed while holding publishedMutex since
+  // readers load it concurrently to the thread that decomposes.
+  std::shared_ptr<const ImplementationOf> published;
+  std::mutex publishedMutex;
 };
 
+template <typename... Args>
+DynamicalDecomposition::DynamicalDecomposition(PrivateConstructor, Args&&... args) :
+  self(std::forward<Args>(args)...) {}
+
 }  // namespace intervalxt
 
 #endif
@@ -48,7 +48,7 @@ class ImplementationOf<HalfEdge> : public ImplementationOfDecomposition {
 
 template <typename... Args>
 HalfEdge::HalfEdge(PrivateConstructor, Args&&... args) :
-  self(spimpl::make_impl<ImplementationOf<HalfEdge>>(std::forward<Args>(args)...)) {}
+  self(std::in_place, std::forward<Args>(args)...) {}
 
 }  // namespace intervalxt
 
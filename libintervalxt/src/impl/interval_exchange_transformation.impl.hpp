@@ -21,7 +21,10 @@
 #ifndef LIBINTERVALXT_INTERVAL_EXCHANGE_TRANSFORMATION_IMPL_HPP
 #define LIBINTERVALXT_INTERVAL_EXCHANGE_TRANSFORMATION_IMPL_HPP
 
+#include <functional>
 #include <list>
+#include <optional>
+#include <vector>
 
 #include "../../intervalxt/interval_exchange_transformation.hpp"
 #include "interval.hpp"
@@ -32,11 +35,34 @@ namespace intervalxt {
 template <>
 class ImplementationOf<IntervalExchangeTransformation> {
  public:
+  // A subtraction performed by zorichInduction(): the lengths of the labels
+  // starting at subtrahend on the bottom have been subtracted from minuend,
+  // the first label on top. Since the IET might be swapped during induction,
+  // we also record whether the minuend is really on top.
+  struct Subtraction {
+    Label minuend;
+    Label subtrahend;
+    bool minuendOnTop;
+  };
+
   ImplementationOf(std::shared_ptr<Lengths>, const std::vector<Label>&, const std::vector<Label>&);
 
   static IntervalExchangeTransformation withLengths(const IntervalExchangeTransformation&, const std::function<std::shared_ptr<Lengths>(std::shared_ptr<Lengths>)>&);
+  // Return an independent copy of this IET including its Lengths and the
+  // state of its induction.
+  static IntervalExchangeTransformation clone(const IntervalExchangeTransformation&);
   static std::string render(const IntervalExchangeTransformation&, Label);
 
+  static ImplementationOf& self(IntervalExchangeTransformation&);
+  static const ImplementationOf& self(const IntervalExchangeTransformation&);
+
+  // Make zorichInduction() log the subtractions it performs on this IET.
+  static void record(IntervalExchangeTransformation&);
+
+  // Call consume for each subtraction that has been logged since the last
+  // call and clear the log.
+  static void drain(IntervalExchangeTransformation&, const std::function<void(const Subtraction&)>& consume);
+
   // Return the translation vectors for the labels on top.
   // Each output is a vector of mpq_class with respect to the irrational basis
   // used for the lengths of the iet.
@@ -68,6 +94,10 @@ class ImplementationOf<IntervalExchangeTransformation> {
   mutable std::optional<std::vector<mpq_class>> safCache = std::nullopt;
   SimilarityTracker similarityTracker = {};
   bool swap = false;
+
+  // The subtractions that have not been drained yet; only logged when
+  // record() has been called, i.e., when the IET is part of a decomposition.
+  std::optional<std::vector<Subtraction>> subtractions = std::nullopt;
 };
 
 }  // namespace intervalxt
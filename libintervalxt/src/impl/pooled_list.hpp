@@ -0,0 +1,282 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_POOLED_LIST_HPP
+#define LIBINTERVALXT_POOLED_LIST_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace intervalxt {
+
+template <typename T>
+class PooledList;
+
+// The storage for the elements of many PooledLists.
+// Elements are never released individually; their memory is released when
+// the pool is destroyed.
+// Elements are stored in blocks of fixed capacity that are never
+// reallocated, so references to elements remain valid when further elements
+// are allocated.
+template <typename T>
+class Pool {
+ public:
+  Pool() = default;
+  Pool(const Pool& other) { *this = other; }
+  Pool(Pool&&) noexcept = default;
+
+  Pool& operator=(const Pool& other) {
+    if (this != &other) {
+      blocks.clear();
+      // Copying a vector does not preserve its capacity, so we need to
+      // reserve a full block again before copying the elements.
+      for (const auto& block : other.blocks) {
+        blocks.emplace_back().reserve(capacity);
+        blocks.back().insert(blocks.back().end(), block.begin(), block.end());
+      }
+    }
+    return *this;
+  }
+
+  Pool& operator=(Pool&&) noexcept = default;
+
+  // Return the number of elements that have been allocated in this pool.
+  size_t size() const noexcept { return blocks.empty() ? 0 : (blocks.size() - 1) * capacity + blocks.back().size(); }
+
+  // Return the number of bytes that this pool currently reserves.
+  size_t memory() const noexcept { return blocks.size() * capacity * sizeof(Node); }
+
+ private:
+  friend PooledList<T>;
+
+  static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+  // The number of elements in each block.
+  static constexpr uint32_t capacity = 64;
+
+  struct Node {
+    T value;
+    uint32_t prev;
+    uint32_t next;
+  };
+
+  uint32_t allocate(const T& value) {
+    const size_t index = size();
+    if (index >= none)
+      throw std::length_error("too many elements in pool");
+    if (index % capacity == 0)
+      blocks.emplace_back().reserve(capacity);
+    blocks.back().push_back(Node{value, none, none});
+    return static_cast<uint32_t>(index);
+  }
+
+  Node& node(uint32_t index) noexcept { return blocks[index / capacity][index % capacity]; }
+
+  std::vector<std::vector<Node>> blocks;
+};
+
+// A doubly linked list whose elements live in a Pool, i.e., a std::list that
+// does not allocate every element separately.
+// Lists that exchange elements with splice() must share the same pool. Since
+// a list only refers to its elements in the pool, a list cannot be copied
+// implicitly; a copy of a list needs to refer to a copy of its pool, see
+// PooledList(Pool&, const PooledList&).
+template <typename T>
+class PooledList {
+  static constexpr uint32_t none = Pool<T>::none;
+
+  template <bool Const>
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    Iterator() noexcept = default;
+
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    Iterator(const Iterator<false>& other) noexcept :
+      list(other.list),
+      node(other.node) {}
+
+    reference operator*() const { return list->pool->node(node).value; }
+    pointer operator->() const { return &**this; }
+
+    Iterator& operator++() {
+      node = list->pool->node(node).next;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    Iterator& operator--() {
+      node = node == none ? list->tail : list->pool->node(node).prev;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      Iterator ret = *this;
+      --*this;
+      return ret;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.list == rhs.list && lhs.node == rhs.node; }
+    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept { return !(lhs == rhs); }
+
+   private:
+    friend PooledList;
+    friend Iterator<!Const>;
+
+    Iterator(const PooledList* list, uint32_t node) noexcept :
+      list(list),
+      node(node) {}
+
+    const PooledList* list = nullptr;
+    uint32_t node = none;
+  };
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  explicit PooledList(Pool<T>& pool) noexcept :
+    pool(&pool) {}
+
+  // Create a list with the elements of other in pool which must be a copy of
+  // the pool of other.
+  PooledList(Pool<T>& pool, const PooledList& other) noexcept :
+    pool(&pool),
+    head(other.head),
+    tail(other.tail) {}
+
+  PooledList(const PooledList&) = delete;
+
+  // Move the elements of other into a new list; other is empty afterwards.
+  PooledList(PooledList&& other) noexcept :
+    pool(other.pool),
+    head(other.head),
+    tail(other.tail) {
+    other.head = other.tail = none;
+  }
+
+  PooledList& operator=(const PooledList&) = delete;
+
+  PooledList& operator=(PooledList&& other) noexcept {
+    if (this != &other) {
+      pool = other.pool;
+      head = other.head;
+      tail = other.tail;
+      other.head = other.tail = none;
+    }
+    return *this;
+  }
+
+  iterator begin() noexcept { return {this, head}; }
+  const_iterator begin() const noexcept { return {this, head}; }
+  iterator end() noexcept { return {this, none}; }
+  const_iterator end() const noexcept { return {this, none}; }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+  reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+  bool empty() const noexcept { return head == none; }
+  size_t size() const noexcept { return std::distance(begin(), end()); }
+
+  T& front() { return *begin(); }
+  const T& front() const { return *begin(); }
+  T& back() { return *--end(); }
+  const T& back() const { return *--end(); }
+
+  friend iterator begin(PooledList& list) noexcept { return list.begin(); }
+  friend const_iterator begin(const PooledList& list) noexcept { return list.begin(); }
+  friend iterator end(PooledList& list) noexcept { return list.end(); }
+  friend const_iterator end(const PooledList& list) noexcept { return list.end(); }
+
+  // Insert a copy of value before pos.
+  iterator insert(const_iterator pos, const T& value) {
+    const uint32_t node = pool->allocate(value);
+    const uint32_t next = pos.node;
+    const uint32_t prev = next == none ? tail : pool->node(next).prev;
+    link(prev, node);
+    link(node, next);
+    return {this, node};
+  }
+
+  void push_front(const T& value) { insert(begin(), value); }
+  void push_back(const T& value) { insert(end(), value); }
+
+  // Move all the elements of other before pos in constant time.
+  void splice(const_iterator pos, PooledList& other) {
+    assert(pool == other.pool && "can only splice lists that share a pool");
+
+    if (&other == this || other.empty())
+      return;
+
+    const uint32_t first = other.head;
+    const uint32_t last = other.tail;
+    other.head = other.tail = none;
+
+    const uint32_t next = pos.node;
+    const uint32_t prev = next == none ? tail : pool->node(next).prev;
+    link(prev, first);
+    link(last, next);
+  }
+
+ private:
+  // Make next follow prev in this list where none denotes the (virtual)
+  // element before the head and after the tail.
+  void link(uint32_t prev, uint32_t next) noexcept {
+    if (prev == none)
+      head = next;
+    else
+      pool->node(prev).next = next;
+
+    if (next == none)
+      tail = prev;
+    else
+      pool->node(next).prev = prev;
+  }
+
+  Pool<T>* pool;
+  uint32_t head = none;
+  uint32_t tail = none;
+};
+
+}  // namespace intervalxt
+
+#endif
@@ -44,7 +44,7 @@ class ImplementationOf<Separatrix> : public ImplementationOfDecomposition {
 
 template <typename... Args>
 Separatrix::Separatrix(PrivateConstructor, Args&&... args) :
-  self(spimpl::make_impl<ImplementationOf<Separatrix>>(std::forward<Args>(args)...)) {}
+  self(std::in_place, std::forward<Args>(args)...) {}
 
 }  // namespace intervalxt
 
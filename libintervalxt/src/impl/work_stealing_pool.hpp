@@ -0,0 +1,172 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#ifndef LIBINTERVALXT_WORK_STEALING_POOL_HPP
+#define LIBINTERVALXT_WORK_STEALING_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace intervalxt {
+
+// A fixed number of threads that run tasks which may submit further tasks.
+// Each thread has its own queue of tasks. A thread runs the tasks it
+// submitted itself last-in-first-out (which keeps its working set small) and
+// when it runs out of work, it steals the oldest task of another thread.
+class WorkStealingPool {
+ public:
+  explicit WorkStealingPool(size_t threads) :
+    queues(threads) {
+    for (size_t i = 0; i < threads; i++)
+      workers.emplace_back([this, i]() { work(i); });
+  }
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  ~WorkStealingPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers)
+      worker.join();
+  }
+
+  // Schedule task on the queue of the calling thread if it is a thread of
+  // this pool, and on the queue of some thread otherwise.
+  void submit(std::function<void()> task) {
+    size_t queue;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      // Count the task as pending before it can be taken so that wait() does
+      // not return while it is running.
+      pending++;
+      queue = current == this ? index : (next++ % queues.size());
+    }
+    {
+      std::lock_guard<std::mutex> lock(queues[queue].mutex);
+      queues[queue].tasks.push_back(std::move(task));
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queued++;
+    }
+    wake.notify_one();
+  }
+
+  // Block until all submitted tasks, including the ones they submitted, have
+  // been run. Rethrows the first exception thrown by a task.
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&]() { return pending == 0; });
+    if (error) std::rethrow_exception(std::exchange(error, nullptr));
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  // Take the newest task from queue i or the oldest task from any other queue.
+  bool take(size_t i, std::function<void()>& task) {
+    for (size_t j = 0; j < queues.size(); j++) {
+      auto& queue = queues[(i + j) % queues.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) continue;
+      if (j == 0) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+      return true;
+    }
+    return false;
+  }
+
+  void work(size_t i) {
+    current = this;
+    index = i;
+
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait(lock, [&]() { return stopping || queued > 0; });
+        if (stopping) return;
+      }
+
+      std::function<void()> task;
+      if (!take(i, task)) continue;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued--;
+      }
+
+      std::exception_ptr failure;
+      try {
+        task();
+      } catch (...) {
+        failure = std::current_exception();
+      }
+      // Release whatever the task captured before reporting it as done.
+      task = nullptr;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (failure && !error) error = failure;
+        if (--pending == 0) done.notify_all();
+      }
+    }
+  }
+
+  std::vector<Queue> queues;
+  std::vector<std::thread> workers;
+
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+  // The number of tasks that have been submitted but not finished yet.
+  size_t pending = 0;
+  // The number of tasks that are waiting in a queue. This can be negative
+  // briefly when a task is taken before its submission has been counted.
+  std::ptrdiff_t queued = 0;
+  size_t next = 0;
+  bool stopping = false;
+  std::exception_ptr error;
+
+  // The pool and the queue of the calling thread, if it is a worker thread.
+  inline static thread_local const WorkStealingPool* current = nullptr;
+  inline static thread_local size_t index = 0;
+};
+
+}  // namespace intervalxt
+
+#endif
@@ -38,11 +38,11 @@ const std::deque<DecompositionState::Component>& ImplementationOfDecomposition::
 }
 
 DecompositionState::Connections& ImplementationOfDecomposition::connections(const Label& at) {
-  return state().connections.at(at);
+  return state().connections(at);
 }
 
 const DecompositionState::Connections& ImplementationOfDecomposition::connections(const Label& at) const {
-  return state().connections.at(at);
+  return state().connections(at);
 }
 
 ImplementationOf<DynamicalDecomposition>& ImplementationOfDecomposition::impl() {
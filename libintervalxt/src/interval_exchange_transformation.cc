@@ -26,13 +26,16 @@
 
 #include <algorithm>
 #include <list>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "../intervalxt/budget.hpp"
 #include "../intervalxt/fmt.hpp"
 #include "../intervalxt/induction_step.hpp"
 #include "../intervalxt/label.hpp"
 #include "external/rx-ranges/include/rx/ranges.hpp"
+#include "impl/budget.impl.hpp"
 #include "impl/interval.hpp"
 #include "impl/interval_exchange_transformation.impl.hpp"
 #include "impl/rational_affine_subspace.hpp"
@@ -44,6 +47,11 @@ namespace intervalxt {
 
 namespace {
 
+// The Parma Polyhedra Library keeps some global state (unless it has been
+// built with --enable-thread-safe) so we never use it from several threads,
+// e.g., when decomposing components in parallel.
+std::mutex ppl;
+
 template <typename T>
 std::vector<T> wedge(std::vector<T> v1, std::vector<T> v2) {
   LIBINTERVALXT_CHECK_ARGUMENT(v1.size() == v2.size(), "vectors must have same size but " << v1.size() << " != " << v2.size());
@@ -91,6 +99,8 @@ bool IntervalExchangeTransformation::zorichInduction() {
       // Zorich acceleration step: perform m full Dehn twists
       // and a partial twist.
       Label stop = lengths.subtractRepeated(*top);
+      if (self->subtractions)
+        self->subtractions->push_back({*top, *begin(self->bottom), !self->swap});
       while (*bottom != stop) bottom--;
 
       bottom++;
@@ -103,6 +113,8 @@ bool IntervalExchangeTransformation::zorichInduction() {
 
       // partial twist
       lengths.subtract(*top);
+      if (self->subtractions && bottom != begin(self->bottom))
+        self->subtractions->push_back({*top, *begin(self->bottom), !self->swap});
 
       break;
     }
@@ -134,6 +146,7 @@ bool IntervalExchangeTransformation::boshernitzanNoPeriodicTrajectory() const {
 
   const auto relations = boshernitzanEquations();
 
+  std::lock_guard<std::mutex> lock(ppl);
   const auto space = RationalAffineSubspace(relations, std::vector<mpq_class>(relations.size()));
   return not space.hasNonZeroNonNegativeVector();
 }
@@ -164,7 +177,10 @@ bool IntervalExchangeTransformation::boshernitzanNoSaddleConnection(const Label&
     // obvious saddle connection here.
     return false;
 
-  const auto space = RationalAffineSubspace(boshernitzanEquations(), values);
+  const auto relations = boshernitzanEquations();
+
+  std::lock_guard<std::mutex> lock(ppl);
+  const auto space = RationalAffineSubspace(relations, values);
   return not space.hasNonNegativeVector();
 }
 
@@ -197,6 +213,10 @@ std::vector<mpq_class> IntervalExchangeTransformation::boshernitzanSaddleConnect
 }
 
 InductionStep IntervalExchangeTransformation::induce(int limit) {
+  return induce(ImplementationOf<Budget>::unlimited(), limit);
+}
+
+InductionStep IntervalExchangeTransformation::induce(const Budget& budget, int limit) {
   using Result = InductionStep::Result;
 
   if (size() == 1) {
@@ -209,6 +229,8 @@ InductionStep IntervalExchangeTransformation::induce(int limit) {
     const bool saf0 = self->saf0();
 
     for (int i = 0; limit == -1 || i < limit; i++) {
+      if (!ImplementationOf<Budget>::spend(budget)) break;
+
       if (saf0) {
         // When SAF=0 the Boshernitzan criterion will not be useful so we try to
         // find a loop in the IETs we see.
@@ -264,6 +286,12 @@ InductionStep IntervalExchangeTransformation::induce(int limit) {
 
   LIBINTERVALXT_ASSERT(!foundSaddleConnection, "Zorich Induction found a Saddle Connection in " << *this << " but induce() failed to see it.");
 
+  // Boshernitzan's criterion can be much more costly than the induction
+  // itself so we do not start it with an exhausted budget.
+  if (budget.exhausted()) {
+    return {Result::LIMIT_REACHED};
+  }
+
   if (boshernitzanNoPeriodicTrajectory()) {
     return {Result::WITHOUT_PERIODIC_TRAJECTORY_BOSHERNITZAN};
   }
@@ -356,7 +384,12 @@ std::optional<IntervalExchangeTransformation> IntervalExchangeTransformation::re
     LIBINTERVALXT_ASSERT(self->top.size() == self->bottom.size(), "top and bottom must have the same length after splitting of a component");
 
     self->safCache = std::nullopt;
-    return IntervalExchangeTransformation(self->lengths, newComponentTop, newComponentBottom);
+
+    // The new component gets its own lengths so that the two components can
+    // be induced independently. (For the typical lengths this does not copy
+    // the actual lengths until one of the components is induced.)
+    auto lengths = std::make_shared<Lengths>(self->lengths->only(std::unordered_set<Label>(begin(newComponentTop), end(newComponentTop))));
+    return IntervalExchangeTransformation(std::move(lengths), newComponentTop, newComponentBottom);
   }
 }
 
@@ -488,6 +521,38 @@ IntervalExchangeTransformation ImplementationOf<IntervalExchangeTransformation>:
   return IntervalExchangeTransformation(createLengths(iet.self->lengths), iet.top(), iet.bottom());
 }
 
+IntervalExchangeTransformation ImplementationOf<IntervalExchangeTransformation>::clone(const IntervalExchangeTransformation& iet) {
+  auto clone = withLengths(iet, [](std::shared_ptr<Lengths> lengths) { return std::make_shared<Lengths>(*lengths); });
+  clone.self->safCache = iet.self->safCache;
+  clone.self->similarityTracker = iet.self->similarityTracker;
+  clone.self->swap = iet.self->swap;
+  clone.self->subtractions = iet.self->subtractions;
+  return clone;
+}
+
+ImplementationOf<IntervalExchangeTransformation>& ImplementationOf<IntervalExchangeTransformation>::self(IntervalExchangeTransformation& iet) {
+  return *iet.self;
+}
+
+const ImplementationOf<IntervalExchangeTransformation>& ImplementationOf<IntervalExchangeTransformation>::self(const IntervalExchangeTransformation& iet) {
+  return *iet.self;
+}
+
+void ImplementationOf<IntervalExchangeTransformation>::record(IntervalExchangeTransformation& iet) {
+  if (!iet.self->subtractions)
+    iet.self->subtractions.emplace();
+}
+
+void ImplementationOf<IntervalExchangeTransformation>::drain(IntervalExchangeTransformation& iet, const std::function<void(const Subtraction&)>& consume) {
+  if (!iet.self->subtractions)
+    return;
+
+  for (const auto& subtraction : *iet.self->subtractions)
+    consume(subtraction);
+
+  iet.self->subtractions->clear();
+}
+
 std::string ImplementationOf<IntervalExchangeTransformation>::render(const IntervalExchangeTransformation& iet, Label label) {
   return iet.self->lengths->render(label);
 }
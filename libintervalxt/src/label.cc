@@ -20,14 +20,23 @@
 
 #include "../intervalxt/label.hpp"
 
-#include <stdlib.h>
-
+#include <atomic>
+#include <limits>
 #include <ostream>
 
 namespace intervalxt {
 
+namespace {
+
+// Labels created with Label() draw their ids from the upper half of the
+// possible ids. So they are deterministic and they never collide with the
+// dense ids 0, 1, 2, … that Lengths such as sample::Lengths hand out.
+std::atomic<size_t> nextId = std::numeric_limits<size_t>::max() / 2 + 1;
+
+}  // namespace
+
 Label::Label() noexcept :
-  id(static_cast<size_t>(random())) {}
+  id(nextId.fetch_add(1, std::memory_order_relaxed)) {}
 
 Label::Label(size_t id) :
   id(id) {}
@@ -19,15 +19,11 @@
  *********************************************************************/
 
 #include <ostream>
-// Work around https://github.com/simonask/rx-ranges/pull/48
-#include <limits>
 
-#include "external/rx-ranges/include/rx/ranges.hpp"
 #include "impl/decomposition_state.hpp"
 #include "impl/dynamical_decomposition.impl.hpp"
 #include "impl/implementation_of_decomposition.hpp"
 #include "impl/separatrix.impl.hpp"
-#include "util/assert.ipp"
 
 namespace intervalxt {
 
@@ -56,23 +52,17 @@ std::ostream& operator<<(std::ostream& os, const Separatrix& self) {
 }
 
 DecompositionState::Separatrix ImplementationOf<Separatrix>::makeAtTop(const DynamicalDecomposition& decomposition, Label label) {
-  DecompositionState::Separatrix separatrix = {label, DecompositionState::Separatrix::Orientation::ANTIPARALLEL};
-  ImplementationOf<DynamicalDecomposition>::self(decomposition).decomposition.connections.at(label).topRight | rx::reverse() | rx::for_each([&](const auto& connection) {
-    LIBINTERVALXT_ASSERT(make(decomposition, separatrix) == make(decomposition, connection.target), "connection separatrices do not form a continuous chain");
-    separatrix.label = connection.source.label;
-  });
-
-  return separatrix;
+  // The separatrix at the top of label is where the outermost connection
+  // right of it starts. This is not checked to be consistent with the
+  // remaining connections since connections added by inject() need not lead
+  // from one separatrix of label to the next.
+  const auto& topRight = ImplementationOf<DynamicalDecomposition>::self(decomposition).decomposition.connections(label).topRight;
+  return {topRight.empty() ? label : topRight.front().source.label, DecompositionState::Separatrix::Orientation::ANTIPARALLEL};
 }
 
 DecompositionState::Separatrix ImplementationOf<Separatrix>::makeAtBottom(const DynamicalDecomposition& decomposition, Label label) {
-  DecompositionState::Separatrix separatrix = {label, DecompositionState::Separatrix::Orientation::PARALLEL};
-  ImplementationOf<DynamicalDecomposition>::self(decomposition).decomposition.connections.at(label).bottomRight | rx::for_each([&](const auto& connection) {
-    LIBINTERVALXT_ASSERT(make(decomposition, separatrix) == make(decomposition, connection.source), "connection separatrices do not form a continuous chain");
-    separatrix.label = connection.target.label;
-  });
-
-  return separatrix;
+  const auto& bottomRight = ImplementationOf<DynamicalDecomposition>::self(decomposition).decomposition.connections(label).bottomRight;
+  return {bottomRight.empty() ? label : bottomRight.back().target.label, DecompositionState::Separatrix::Orientation::PARALLEL};
 }
 
 }  // namespace intervalxt
@@ -0,0 +1,86 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#include <e-antic/renfxx.h>
+#include <gmpxx.h>
+
+#include <exact-real/element.hpp>
+#include <exact-real/integer_ring.hpp>
+#include <exact-real/module.hpp>
+#include <exact-real/number_field.hpp>
+#include <exact-real/rational_field.hpp>
+#include <exact-real/real_number.hpp>
+#include <vector>
+
+#include "../intervalxt/sample/approximation.hpp"
+#include "../intervalxt/sample/coordinate_lengths.hpp"
+#include "../intervalxt/sample/element_approximation.hpp"
+#include "../intervalxt/sample/element_coefficients.hpp"
+#include "../intervalxt/sample/element_floor_division.hpp"
+#include "../intervalxt/sample/mpq_approximation.hpp"
+#include "../intervalxt/sample/mpz_approximation.hpp"
+#include "../intervalxt/sample/renf_elem_approximation.hpp"
+#include "../intervalxt/sample/renf_elem_floor_division.hpp"
+#include "external/catch2/single_include/catch2/catch.hpp"
+
+namespace intervalxt::test {
+
+TEMPLATE_TEST_CASE("Approximations Contain Elements", "[approximation]", (mpz_class), (mpq_class), (eantic::renf_elem_class), (exactreal::Element<exactreal::IntegerRing>), (exactreal::Element<exactreal::RationalField>), (exactreal::Element<exactreal::NumberField>)) {
+  using T = TestType;
+
+  for (int value : {0, 1, -1, 1337}) {
+    const auto enclosure = sample::Approximation<T>()(T(value));
+    REQUIRE(enclosure.lower <= value);
+    REQUIRE(enclosure.upper >= value);
+  }
+}
+
+TEST_CASE("Floor Division From Approximations", "[approximation]") {
+  using namespace eantic;
+  auto K = renf_class::make("a^2 - 2", "a", "1.41 +/- 0.01");
+  const auto x = K->gen();
+
+  REQUIRE(sample::approximateFloorDivision(1000 * x, renf_elem_class(*K, 1)) == mpz_class(1414));
+  REQUIRE(sample::approximateFloorDivision(7 * x, x) == mpz_class(7));
+  REQUIRE(sample::FloorDivision<renf_elem_class>()(7 * x - 1, x) == mpz_class(6));
+}
+
+TEST_CASE("Comparisons of Coordinate Lengths Refine Approximations", "[approximation]") {
+  using namespace exactreal;
+  using T = Element<RationalField>;
+  using CoordinateLengths = sample::CoordinateLengths<T>;
+
+  const auto M = Module<RationalField>::make({RealNumber::rational(1), RealNumber::random()});
+  const auto x = M->gen(1);
+
+  // The difference of a and b is so small that doubles cannot decide cmp().
+  auto&& [lengths, a, b, c] = CoordinateLengths::make(T(1) + x, T(1) + x + x * mpq_class("1/1000000000000000000000000000000"), T(1) + x);
+
+  REQUIRE(lengths.cmp(a, b) < 0);
+  REQUIRE(lengths.statistics().refinements > 0);
+  REQUIRE(lengths.statistics().exact == 0);
+
+  REQUIRE(lengths.cmp(a, c) == 0);
+
+  const auto derived = lengths.forget();
+  REQUIRE(derived.cmp(a, b) < 0);
+  REQUIRE(lengths.statistics().comparisons == 3);
+}
+
+}  // namespace intervalxt::test
@@ -18,7 +18,6 @@
  *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
  *********************************************************************/
 
-#include <boost/type_erasure/any_cast.hpp>
 #include <cereal/archives/json.hpp>
 #include <e-antic/cereal.hpp>
 #include <exact-real/cereal.hpp>
@@ -98,7 +97,7 @@ TEMPLATE_TEST_CASE("Serialization of Lengths", "[cereal][lengths]", (int), (eant
 
   SECTION("Serialization of Lengths With Type Erasure") {
     const auto equality = [](const Lengths& lhs, const Lengths& rhs) {
-      return boost::type_erasure::any_cast<TLengths>(lhs) == boost::type_erasure::any_cast<TLengths>(rhs);
+      return *lhs.target<TLengths>() == *rhs.target<TLengths>();
     };
 
     TLengths unerased({T(1), T(2), T(3)});
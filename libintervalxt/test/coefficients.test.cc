@@ -27,10 +27,16 @@
 #include <exact-real/rational_field.hpp>
 #include <vector>
 
+#include "../intervalxt/sample/checked_integer_coefficients.hpp"
+#include "../intervalxt/sample/checked_integer_floor_division.hpp"
 #include "../intervalxt/sample/element_coefficients.hpp"
 #include "../intervalxt/sample/integer_coefficients.hpp"
+#include "../intervalxt/sample/integer_floor_division.hpp"
+#include "../intervalxt/sample/lengths.hpp"
 #include "../intervalxt/sample/mpq_coefficients.hpp"
+#include "../intervalxt/sample/mpq_floor_division.hpp"
 #include "../intervalxt/sample/mpz_coefficients.hpp"
+#include "../intervalxt/sample/mpz_floor_division.hpp"
 #include "../intervalxt/sample/renf_elem_coefficients.hpp"
 #include "external/catch2/single_include/catch2/catch.hpp"
 
@@ -38,7 +44,7 @@ namespace intervalxt::test {
 
 using std::vector;
 
-TEMPLATE_TEST_CASE("Coefficients Can Be Computed", "[coefficients]", (int), (mpz_class), (mpq_class), (eantic::renf_elem_class), (exactreal::Element<exactreal::IntegerRing>), (exactreal::Element<exactreal::RationalField>), (exactreal::Element<exactreal::NumberField>)) {
+TEMPLATE_TEST_CASE("Coefficients Can Be Computed", "[coefficients]", (int), (sample::CheckedInteger), (mpz_class), (mpq_class), (eantic::renf_elem_class), (exactreal::Element<exactreal::IntegerRing>), (exactreal::Element<exactreal::RationalField>), (exactreal::Element<exactreal::NumberField>)) {
   using T = TestType;
 
   SECTION("Zero has no non-zero coefficients") {
@@ -47,6 +53,44 @@ TEMPLATE_TEST_CASE("Coefficients Can Be Computed", "[coefficients]", (int), (mpz
     REQUIRE(coefficients.size() == 1);
     REQUIRE(std::all_of(begin(coefficients[0]), end(coefficients[0]), [](const auto& c) { return c == 0; }));
   }
+
+  SECTION("Coefficients Do Not Depend on Previous Calls") {
+    auto coefficients = sample::Coefficients<T>();
+    const auto one = coefficients({T(1)});
+    REQUIRE(coefficients({T(), T(1), T(2)}).size() == 3);
+    REQUIRE(coefficients({T(1)}) == one);
+  }
+}
+
+TEMPLATE_TEST_CASE("Coefficients of Lengths Are Updated", "[coefficients]", (int), (sample::CheckedInteger), (mpz_class), (mpq_class)) {
+  using T = TestType;
+  using TLengths = sample::Lengths<T>;
+
+  auto&& [lengths, a, b, c] = TLengths::make(T(7), T(2), T(3));
+
+  REQUIRE(lengths.coefficients({a, b, c}) == vector<vector<mpq_class>>{{7}, {2}, {3}});
+
+  lengths.push(b);
+  lengths.subtract(a);
+
+  REQUIRE(lengths.coefficients({a, b, c}) == vector<vector<mpq_class>>{{5}, {2}, {3}});
+  REQUIRE(lengths.coefficients({c, a}) == vector<vector<mpq_class>>{{3}, {5}});
+
+  lengths.push(c);
+  lengths.subtract(a);
+
+  REQUIRE(lengths.coefficients({c, a}) == vector<vector<mpq_class>>{{3}, {2}});
+  REQUIRE(lengths.coefficients({a, b, c}) == vector<vector<mpq_class>>{{2}, {2}, {3}});
+
+  auto&& [repeated, x, y, z] = TLengths::make(T(23), T(5), T(2));
+
+  REQUIRE(repeated.coefficients({x, y, z}) == vector<vector<mpq_class>>{{23}, {5}, {2}});
+
+  repeated.push(y);
+  repeated.push(z);
+  repeated.subtractRepeated(x);
+
+  REQUIRE(repeated.coefficients({x, y, z}) == vector<vector<mpq_class>>{{2}, {5}, {2}});
 }
 
 }  // namespace intervalxt::test
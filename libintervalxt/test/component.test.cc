@@ -42,6 +42,21 @@ TEST_CASE("Components of a Decomposition", "[component]") {
   SECTION("iet() works") {
     REQUIRE(fmt::format("{}", iet) == fmt::format("{}", decomposition.components()[0].iet()));
   }
+
+  SECTION("Iterators of Views Outlive their Range") {
+    decomposition.decompose();
+    const auto component = decomposition.components()[0];
+
+    std::vector<Side> perimeter;
+    for (auto it = component.perimeterView().begin(); it != component.perimeterView().end(); ++it)
+      perimeter.push_back(*it);
+    REQUIRE(perimeter == component.perimeter());
+
+    std::vector<HalfEdge> contour;
+    for (auto it = component.topContourView().begin(); it != component.topContourView().end(); ++it)
+      contour.push_back(*it);
+    REQUIRE(contour == component.topContour());
+  }
 }
 
 }  // namespace intervalxt::test
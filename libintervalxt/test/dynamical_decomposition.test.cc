@@ -21,8 +21,16 @@
 #include <e-antic/renfxx.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <boost/logic/tribool.hpp>
-
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../intervalxt/budget.hpp"
 #include "../intervalxt/connection.hpp"
 #include "../intervalxt/decomposition_step.hpp"
 #include "../intervalxt/dynamical_decomposition.hpp"
@@ -379,6 +387,176 @@ TEST_CASE("Decomposition of More Deeply Nested Cylinders") {
   }
 }
 
+TEST_CASE("Parallel Decomposition") {
+  using IntLengths = sample::Lengths<int>;
+
+  // Decompose an IET made of several blocks that split off into separate
+  // components, once serially and once in parallel.
+  const auto decompose = [](unsigned int threads) {
+    auto&& [lengths, a, b, c, d, e, f, g, h, i, j, k, l] = IntLengths::make(1, 1, 1, 1, 3, 5, 7, 2, 2, 3, 1, 4);
+    auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), {a, b, c, d, e, f, g, h, i, j, k, l}, {d, a, c, b, g, f, e, i, h, l, k, j});
+    auto decomposition = DynamicalDecomposition(iet);
+
+    REQUIRE(decomposition.decompose([](const auto& c) { return (c.cylinder() || c.withoutPeriodicTrajectory()) ? true : false; }, -1, threads));
+
+    std::vector<std::string> components;
+    for (const auto& component : decomposition.components())
+      components.push_back(fmt::format("{}", component));
+    std::sort(begin(components), end(components));
+    return components;
+  };
+
+  const auto serial = decompose(1);
+
+  REQUIRE(serial.size() >= 4);
+  REQUIRE(std::find(begin(serial), end(serial), "[c] [c+ ⚯ c-] -[c] [b- ⚯ a+]") != end(serial));
+
+  REQUIRE(decompose(2) == serial);
+  REQUIRE(decompose(4) == serial);
+}
+
+TEST_CASE("Parallel Decomposition with Number Field Lengths") {
+  using EAnticLengths = sample::Lengths<eantic::renf_elem_class>;
+
+  // The lengths of all the components share the number field, whose
+  // embedding is refined when these lengths are compared.
+  const auto K = eantic::renf_class::make("a^2 - 2", "a", "1.414 +/- 0.01");
+  const auto one = eantic::renf_elem_class(*K, 1);
+  const auto a = K->gen();
+
+  const auto decompose = [&](unsigned int threads) {
+    auto&& [lengths, a_, b, c, d, e, f, g, h, i, j, k, l] = EAnticLengths::make(one, a, one, a + 1, 3 * one, 5 * a, 7 * one, 2 * one, 2 * a, 3 * one, a, 4 * one);
+    auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), {a_, b, c, d, e, f, g, h, i, j, k, l}, {d, a_, c, b, g, f, e, i, h, l, k, j});
+    auto decomposition = DynamicalDecomposition(iet);
+
+    REQUIRE(decomposition.decompose([](const auto& c) { return (c.cylinder() || c.withoutPeriodicTrajectory()) ? true : false; }, -1, threads));
+
+    std::vector<std::string> components;
+    for (const auto& component : decomposition.components())
+      components.push_back(fmt::format("{}", component));
+    std::sort(begin(components), end(components));
+    return components;
+  };
+
+  const auto serial = decompose(1);
+
+  REQUIRE(serial.size() >= 4);
+
+  for (int repetition = 0; repetition < 8; repetition++)
+    REQUIRE(decompose(4) == serial);
+}
+
+TEST_CASE("Snapshots of a Decomposition") {
+  using IntLengths = sample::Lengths<int>;
+
+  auto&& [lengths, a, b, c, d, e, f, g, h, i, j, k, l] = IntLengths::make(1, 1, 1, 1, 3, 5, 7, 2, 2, 3, 1, 4);
+  auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), {a, b, c, d, e, f, g, h, i, j, k, l}, {d, a, c, b, g, f, e, i, h, l, k, j});
+  auto decomposition = DynamicalDecomposition(iet);
+
+  const auto render = [](const DynamicalDecomposition& decomposition) {
+    const auto flag = [](boost::logic::tribool value) { return boost::logic::indeterminate(value) ? "?" : value ? "yes" : "no"; };
+
+    std::vector<std::string> components;
+    for (const auto& component : decomposition.components())
+      components.push_back(fmt::format("{} {} {}", component, flag(component.cylinder()), flag(component.withoutPeriodicTrajectory())));
+    return components;
+  };
+
+  SECTION("Snapshots are Published Between Steps") {
+    const auto initial = render(decomposition);
+
+    // Nothing has been published yet.
+    REQUIRE(!decomposition.snapshot());
+
+    // The snapshot requested above is published when the next step begins.
+    auto component = decomposition.components()[0];
+    component.decompositionStep();
+    REQUIRE(render(*decomposition.snapshot()) == initial);
+
+    const auto afterFirstStep = render(decomposition);
+    REQUIRE(afterFirstStep != initial);
+
+    component.decompositionStep();
+    auto snapshot = decomposition.snapshot();
+    REQUIRE(render(*snapshot) == afterFirstStep);
+    REQUIRE(render(*snapshot) != render(decomposition));
+
+    // Every reader gets its own copy which it is free to modify.
+    auto other = decomposition.snapshot();
+    REQUIRE(*other != *snapshot);
+    REQUIRE(other->decompose());
+    REQUIRE(render(*snapshot) == afterFirstStep);
+
+    // The snapshot is independent of the decomposition.
+    REQUIRE(decomposition.decompose());
+    REQUIRE(render(*snapshot) == afterFirstStep);
+
+    // The final state is published when decompose() returns.
+    REQUIRE(render(*decomposition.snapshot()) == render(decomposition));
+  }
+
+  SECTION("Snapshots Can be Read While Decomposing") {
+    // Make sure that a snapshot is published even if the reader below only
+    // starts after the decomposition is done.
+    REQUIRE(!decomposition.snapshot());
+
+    for (unsigned int threads : {1, 4}) {
+      std::atomic<bool> done = false;
+
+      std::thread reader([&]() {
+        while (!done)
+          if (auto snapshot = decomposition.snapshot())
+            render(*snapshot);
+      });
+
+      const bool decomposed = decomposition.decompose([](const auto& c) { return (c.cylinder() || c.withoutPeriodicTrajectory()) ? true : false; }, -1, threads);
+      done = true;
+      reader.join();
+
+      REQUIRE(decomposed);
+      REQUIRE(render(*decomposition.snapshot()) == render(decomposition));
+    }
+  }
+}
+
+TEST_CASE("Decomposition With a Budget") {
+  using IntLengths = sample::Lengths<int>;
+
+  auto&& [lengths, a, b, c, d, e, f, g, h, i, j, k, l] = IntLengths::make(1, 1, 1, 1, 3, 5, 7, 2, 2, 3, 1, 4);
+  auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), {a, b, c, d, e, f, g, h, i, j, k, l}, {d, a, c, b, g, f, e, i, h, l, k, j});
+  auto decomposition = DynamicalDecomposition(iet);
+
+  const auto target = [](const auto& c) { return (c.cylinder() || c.withoutPeriodicTrajectory()) ? true : false; };
+
+  unsigned int threads = GENERATE(1, 4);
+
+  SECTION("Decomposition Stops When All Steps Have Been Spent") {
+    const auto budget = Budget(std::nullopt, 0);
+
+    REQUIRE(!decomposition.decompose(budget, target, -1, threads));
+
+    const auto components = decomposition.components();
+    REQUIRE(!std::all_of(begin(components), end(components), target));
+  }
+
+  SECTION("Decomposition Stops When the Budget Has Been Cancelled") {
+    Budget budget;
+
+    REQUIRE(!decomposition.decompose(
+        budget, [&](const auto& component) {
+          budget.cancel();
+          return target(component);
+        },
+        -1, threads));
+    REQUIRE(budget.cancelled());
+  }
+
+  // An exhausted budget leaves the decomposition in a consistent state from
+  // which it can be resumed.
+  REQUIRE(decomposition.decompose(Budget(std::chrono::hours(1)), target, -1, threads));
+  REQUIRE(decomposition.components().size() == 6);
+}
+
 TEST_CASE("Decomposition Step With Injected Connections") {
   using IntLengths = sample::Lengths<int>;
 
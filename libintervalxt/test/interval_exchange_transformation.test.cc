@@ -20,13 +20,21 @@
 
 #include <e-antic/renfxx.h>
 
+#include <chrono>
+#include <limits>
+#include <optional>
 #include <sstream>
 #include <valarray>
 #include <vector>
 
+#include "../intervalxt/budget.hpp"
+#include "../intervalxt/external/gmpxxll/mpz_class.hpp"
 #include "../intervalxt/induction_step.hpp"
 #include "../intervalxt/interval_exchange_transformation.hpp"
 #include "../intervalxt/label.hpp"
+#include "../intervalxt/sample/checked_integer_coefficients.hpp"
+#include "../intervalxt/sample/checked_integer_floor_division.hpp"
+#include "../intervalxt/sample/coordinate_lengths.hpp"
 #include "../intervalxt/sample/integer_coefficients.hpp"
 #include "../intervalxt/sample/integer_floor_division.hpp"
 #include "../intervalxt/sample/lengths.hpp"
@@ -34,6 +42,7 @@
 #include "../intervalxt/sample/mpq_floor_division.hpp"
 #include "../intervalxt/sample/mpz_coefficients.hpp"
 #include "../intervalxt/sample/mpz_floor_division.hpp"
+#include "../intervalxt/sample/renf_elem_approximation.hpp"
 #include "../intervalxt/sample/renf_elem_coefficients.hpp"
 #include "../intervalxt/sample/renf_elem_floor_division.hpp"
 #include "../src/external/rx-ranges/include/rx/ranges.hpp"
@@ -117,6 +126,11 @@ TEST_CASE("Reduction of an Interval Exchange Transformation", "[interval_exchang
     REQUIRE(r);
     REQUIRE(*r == IET(lengths, {c}, {c}));
     REQUIRE(iet == IET(lengths, {a, b}, {b, a}));
+
+    // The components do not share their lengths.
+    REQUIRE(r->lengths() != iet.lengths());
+    REQUIRE(r->lengths()->get(c) == Length(33));
+    REQUIRE(!r->lengths()->get(a));
   }
 }
 
@@ -167,6 +181,27 @@ TEST_CASE("Zorich Induction on an Interval Exchange Transformation", "[interval_
     REQUIRE(iet == IET(MpzLengths({15560595195676063_mpz, 51123145748597134_mpz}), {a, b}, {b, a}));
   }
 
+  SECTION("Zorich Induction with Checked Integer Coefficients") {
+    using sample::CheckedInteger;
+    using CheckedLengths = sample::Lengths<CheckedInteger>;
+    using MpzLengths = sample::Lengths<mpz_class>;
+
+    const auto max = std::numeric_limits<int64_t>::max();
+
+    // The sum of the lengths of c and b does not fit into an int64_t.
+    auto&& [lengths, a, b, c] = CheckedLengths::make(CheckedInteger(3 * gmpxxll::mpz_class(max)), CheckedInteger(max), CheckedInteger(max));
+    auto iet = IET(lengths, {a, b, c}, {c, b, a});
+    auto reference = IET(MpzLengths({3 * gmpxxll::mpz_class(max), gmpxxll::mpz_class(max), gmpxxll::mpz_class(max)}), {a, b, c}, {c, b, a});
+
+    iet.zorichInduction();
+    reference.zorichInduction();
+
+    std::stringstream printed, expected;
+    printed << iet;
+    expected << reference;
+    REQUIRE(printed.str() == expected.str());
+  }
+
   SECTION("Zorich Induction with MPQ Coefficients") {
     using MpqLengths = sample::Lengths<mpq_class>;
     auto&& [lengths, a, b] = MpqLengths::make(mpq_class(3, 5), mpq_class(1, 4));
@@ -190,6 +225,66 @@ TEST_CASE("Zorich Induction on an Interval Exchange Transformation", "[interval_
     REQUIRE(iet == IET(EAnticLengths({K->gen() - 1, renf_elem_class(*K, 1)}), {a, b}, {b, a}));
   }
 
+  SECTION("Zorich Induction With a Large Quotient in a Number Field") {
+    using namespace eantic;
+    using EAnticLengths = sample::Lengths<renf_elem_class>;
+    auto K = renf_class::make("a^2 - a - 1", "a", "1.618 +/- 0.01");
+    auto&& [lengths, a, b] = EAnticLengths::make(1000 * K->gen(), renf_elem_class(*K, 1));
+
+    auto iet = IET(lengths, {a, b}, {b, a});
+
+    iet.zorichInduction();
+
+    REQUIRE(iet == IET(EAnticLengths({1000 * K->gen() - 1618, renf_elem_class(*K, 1)}), {a, b}, {b, a}));
+  }
+
+  SECTION("Comparisons of e-antic Lengths Use Approximations") {
+    using namespace eantic;
+    using EAnticLengths = sample::Lengths<renf_elem_class>;
+    auto K = renf_class::make("a^2 - a - 1", "a", "1.618 +/- 0.01");
+    auto&& [lengths, a, b] = EAnticLengths::make(K->gen(), renf_elem_class(*K, 1));
+
+    REQUIRE(lengths.cmp(a, b) > 0);
+    lengths.push(b);
+    lengths.push(b);
+    REQUIRE(lengths.cmp(a) > 0);
+    REQUIRE(lengths.cmp(a, a) == 0);
+
+    REQUIRE(lengths.statistics().comparisons == 3);
+    REQUIRE(lengths.statistics().exact == 1);
+  }
+
+  SECTION("Zorich Induction With Coordinate Lengths") {
+    using namespace eantic;
+    using EAnticLengths = sample::Lengths<renf_elem_class>;
+    using CoordinateLengths = sample::CoordinateLengths<renf_elem_class>;
+    auto K = renf_class::make("a^2 - 2", "a", "1.41 +/- 0.01");
+    const auto x = K->gen();
+
+    // Since d = a + c, some comparisons might be ties which cannot be decided
+    // by approximations alone.
+    auto&& [lengths, a, b, c, d] = CoordinateLengths::make(977 * x, renf_elem_class(*K, 351), 143 * x + 12, 1120 * x + 12);
+    auto iet = IET(lengths, {a, b, c, d}, {d, c, b, a});
+    auto reference = IET(EAnticLengths({977 * x, renf_elem_class(*K, 351), 143 * x + 12, 1120 * x + 12}), {a, b, c, d}, {d, c, b, a});
+
+    for (int i = 0; i < 32; i++) {
+      const bool connection = iet.zorichInduction();
+      REQUIRE(connection == reference.zorichInduction());
+
+      std::stringstream printed, expected;
+      printed << iet;
+      expected << reference;
+      REQUIRE(printed.str() == expected.str());
+      REQUIRE(iet.safInvariant() == reference.safInvariant());
+
+      if (connection)
+        break;
+
+      iet.swap();
+      reference.swap();
+    }
+  }
+
   SECTION("Several Iterations of Zorich Induction") {
     auto&& [lengths, a, b, c, d, e] = IntLengths::make(977, 351, 143, 321, 12);
 
@@ -304,6 +399,40 @@ TEST_CASE("Repeated Induction on an Interval Exchange Transformation", "[interva
       REQUIRE(iet.induce(1).result == Result::CYLINDER);
     }
   }
+
+  SECTION("With a Budget") {
+    auto&& [lengths, a, b] = IntLengths::make(13, 5);
+
+    auto iet = IET(lengths, {a, b}, {b, a});
+
+    SECTION("Induction Stops When All Steps Have Been Spent") {
+      auto budget = Budget(std::nullopt, 1);
+
+      REQUIRE(iet.induce(budget).result == Result::LIMIT_REACHED);
+      REQUIRE(budget.steps() == 0);
+      REQUIRE(budget.exhausted());
+
+      REQUIRE(iet.induce(budget).result == Result::LIMIT_REACHED);
+      REQUIRE(iet.induce(Budget(std::nullopt, 1)).result == Result::NON_SEPARATING_CONNECTION);
+    }
+
+    SECTION("Induction Stops When the Budget Has Been Cancelled") {
+      Budget budget;
+
+      // Copies share their state.
+      auto copy = budget;
+      copy.cancel();
+      REQUIRE(budget.cancelled());
+
+      REQUIRE(iet.induce(budget).result == Result::LIMIT_REACHED);
+      REQUIRE(iet.induce(Budget()).result == Result::NON_SEPARATING_CONNECTION);
+    }
+
+    SECTION("Induction Stops at the Deadline") {
+      REQUIRE(iet.induce(Budget(Budget::Clock::now())).result == Result::LIMIT_REACHED);
+      REQUIRE(iet.induce(Budget(std::chrono::hours(1))).result == Result::NON_SEPARATING_CONNECTION);
+    }
+  }
 }
 
 TEST_CASE("Computation of SAF Invariant", "[interval_exchange_transformation][saf_invariant]") {
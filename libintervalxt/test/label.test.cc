@@ -55,6 +55,21 @@ TEST_CASE("Labels Can Be Created and Compared", "[label]") {
   }
 }
 
+TEST_CASE("Fresh Labels Are Distinct From Labels of Lengths", "[label]") {
+  using IntLengths = sample::Lengths<int>;
+
+  auto&& [lengths, a, b, c] = IntLengths::make(1, 2, 3);
+
+  Label fresh;
+
+  REQUIRE(fresh != a);
+  REQUIRE(fresh != b);
+  REQUIRE(fresh != c);
+  REQUIRE(fresh != Label());
+
+  REQUIRE_THROWS(lengths.get(fresh));
+}
+
 TEST_CASE("Labels Can be Printed") {
   SECTION("A Label can be Written to an Output Stream") {
     std::stringstream stream;
@@ -0,0 +1,261 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#include <gmp.h>
+#include <gmpxx.h>
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "../intervalxt/interval_exchange_transformation.hpp"
+#include "../intervalxt/length.hpp"
+#include "../intervalxt/lengths.hpp"
+#include "../intervalxt/sample/integer_coefficients.hpp"
+#include "../intervalxt/sample/integer_floor_division.hpp"
+#include "../intervalxt/sample/lengths.hpp"
+#include "../intervalxt/sample/mpq_coefficients.hpp"
+#include "../intervalxt/sample/mpq_floor_division.hpp"
+#include "../intervalxt/sample/mpz_approximation.hpp"
+#include "../intervalxt/sample/mpz_coefficients.hpp"
+#include "../intervalxt/sample/mpz_floor_division.hpp"
+#include "external/catch2/single_include/catch2/catch.hpp"
+
+namespace intervalxt::test {
+
+TEMPLATE_TEST_CASE("Lengths Can Be Boxed", "[length]", (int), (mpz_class), (mpq_class)) {
+  using T = TestType;
+
+  const Length one = T(1);
+  const Length two = T(2);
+
+  REQUIRE(one.type() == typeid(T));
+
+  SECTION("Lengths Can Be Compared") {
+    REQUIRE(one == Length(T(1)));
+    REQUIRE(one != two);
+    REQUIRE(one < two);
+    REQUIRE(!(two < one));
+    REQUIRE(static_cast<bool>(one));
+    REQUIRE(!Length(T()));
+  }
+
+  SECTION("Lengths Can Be Multiplied") {
+    REQUIRE(two * two == Length(T(4)));
+  }
+
+  SECTION("Lengths Can Be Copied and Moved") {
+    std::vector<Length> lengths{one, two};
+    auto copy = lengths;
+    lengths.clear();
+    REQUIRE(copy == std::vector{one, two});
+
+    Length moved = std::move(copy[0]);
+    REQUIRE(moved == one);
+  }
+
+  SECTION("Lengths Can Be Printed") {
+    std::stringstream stream;
+    stream << two;
+    REQUIRE(stream.str() == "2");
+  }
+}
+
+TEST_CASE("Lengths of Different Types Are Different", "[length]") {
+  REQUIRE(Length(1) != Length(mpz_class(1)));
+  REQUIRE(Length() != Length(1));
+  REQUIRE(Length() == Length());
+  REQUIRE_THROWS(Length(1) * Length(mpz_class(1)));
+}
+
+TEST_CASE("Lengths Are Returned by Type-Erased Lengths", "[length]") {
+  using MpqLengths = sample::Lengths<mpq_class>;
+
+  auto&& [unerased, a, b] = MpqLengths::make(mpq_class(1, 2), mpq_class(1, 3));
+  const Lengths lengths = unerased;
+
+  REQUIRE(lengths.get(a) == Length(mpq_class(1, 2)));
+  REQUIRE(lengths.get(b) < lengths.get(a));
+}
+
+TEST_CASE("Type-Erased Lengths Expose Their Underlying Lengths", "[length]") {
+  using IntLengths = sample::Lengths<int>;
+
+  auto&& [unerased, a, b] = IntLengths::make(2, 1);
+  Lengths lengths = unerased;
+
+  REQUIRE(lengths.type() == typeid(IntLengths));
+  REQUIRE(lengths.target<IntLengths>() != nullptr);
+  REQUIRE(lengths.target<sample::Lengths<mpz_class>>() == nullptr);
+
+  lengths.push(b);
+  REQUIRE(lengths.target<IntLengths>()->cmp(a) < 0);
+  REQUIRE(lengths.get(a).target<int>() != nullptr);
+  REQUIRE(*lengths.get(a).target<int>() == 2);
+
+  Lengths moved = std::move(lengths);
+  REQUIRE(moved.cmp(a) < 0);
+  REQUIRE(lengths.type() == typeid(void));
+  REQUIRE_THROWS(lengths.cmp(a));
+}
+
+TEST_CASE("Derived Lengths Are Independent of Their Origin", "[length]") {
+  using IntLengths = sample::Lengths<int>;
+
+  auto&& [unerased, a, b, c] = IntLengths::make(5, 2, 1);
+  Lengths lengths = unerased;
+
+  auto forget = lengths.forget();
+  auto only = lengths.only({a, c});
+
+  REQUIRE(only.get(a) == Length(5));
+  REQUIRE(only.get(b) == Length(0));
+  REQUIRE(only.get(c) == Length(1));
+
+  lengths.push(b);
+  lengths.subtract(a);
+
+  REQUIRE(lengths.get(a) == Length(3));
+  REQUIRE(forget.get(a) == Length(5));
+  REQUIRE(only.get(a) == Length(5));
+
+  only.push(c);
+  only.subtract(a);
+
+  REQUIRE(only.get(a) == Length(4));
+  REQUIRE(only.get(b) == Length(0));
+  REQUIRE(forget.get(a) == Length(5));
+  REQUIRE(forget.get(b) == Length(2));
+  REQUIRE(lengths.only({b}).only({a, b}).get(a) == Length(0));
+}
+
+TEST_CASE("Partial Sums of Lengths Do Not Modify the Lengths", "[length]") {
+  using MpqLengths = sample::Lengths<mpq_class>;
+
+  auto&& [lengths, a, b, c] = MpqLengths::make(mpq_class(1, 2), mpq_class(1, 3), mpq_class(1, 6));
+
+  auto sum = lengths.sum();
+  sum.push(b);
+  REQUIRE(sum.cmp(a) < 0);
+  sum.push(c);
+  REQUIRE(sum.cmp(a) == 0);
+  REQUIRE(static_cast<mpq_class>(sum) == mpq_class(1, 2));
+
+  auto other = lengths.sum();
+  other.push(c);
+  REQUIRE(other.cmp(b) < 0);
+
+  sum.pop();
+  REQUIRE(sum.cmp(a) < 0);
+  REQUIRE(sum.labels() == std::vector{b});
+
+  REQUIRE(static_cast<mpq_class>(lengths) == 0);
+  lengths.push(b);
+  REQUIRE(lengths.cmp(a) < 0);
+}
+
+TEST_CASE("Partial Sums Can Be Subtracted from Lengths", "[length]") {
+  using MpqLengths = sample::Lengths<mpq_class>;
+
+  auto&& [lengths, a, b, c] = MpqLengths::make(mpq_class(2), mpq_class(1, 3), mpq_class(1, 6));
+  lengths.trackCoefficients();
+
+  auto sum = lengths.sum();
+  sum.push(b);
+  sum.push(c);
+
+  lengths.subtract(sum, a);
+  REQUIRE(lengths.get(a) == Length(mpq_class(3, 2)));
+  REQUIRE(sum.cmp(a) < 0);
+
+  REQUIRE(lengths.subtractRepeated(sum, a) == b);
+  REQUIRE(lengths.get(a) == Length(mpq_class(1, 6)));
+  REQUIRE(sum.cmp(a) > 0);
+
+  // The coefficients are updated along with the lengths.
+  REQUIRE(lengths.coefficients({a, b, c}) == std::vector<std::vector<mpq_class>>{{mpq_class(1, 6)}, {mpq_class(1, 3)}, {mpq_class(1, 6)}});
+  REQUIRE(lengths.coefficients({c, a}) == std::vector<std::vector<mpq_class>>{{mpq_class(1, 6)}, {mpq_class(1, 6)}});
+}
+
+namespace {
+
+// Counts the allocations that GMP performs while it is alive.
+class CountGmpAllocations {
+ public:
+  CountGmpAllocations() {
+    mp_get_memory_functions(&allocate, &reallocate, &free);
+    count = 0;
+    mp_set_memory_functions(
+        [](size_t size) { count++; return allocate(size); },
+        [](void* ptr, size_t old, size_t size) { count++; return reallocate(ptr, old, size); },
+        free);
+  }
+
+  ~CountGmpAllocations() {
+    mp_set_memory_functions(allocate, reallocate, free);
+  }
+
+  size_t allocations() const { return count; }
+
+ private:
+  static inline void* (*allocate)(size_t);
+  static inline void* (*reallocate)(void*, size_t, size_t);
+  static inline void (*free)(void*, size_t);
+  static inline size_t count;
+};
+
+}  // namespace
+
+TEST_CASE("Zorich Induction Hardly Allocates", "[length]") {
+  gmp_randclass random(gmp_randinit_default);
+  random.seed(1337);
+
+  const bool track = GENERATE(false, true);
+
+  size_t steps = 0;
+  size_t allocations = 0;
+
+  for (int i = 0; i < 32; i++) {
+    std::vector<mpz_class> values;
+    for (int j = 0; j < 7; j++)
+      values.push_back(random.get_z_bits(1024) + 1);
+
+    auto lengths = sample::Lengths<mpz_class>(values);
+    if (track)
+      lengths.trackCoefficients();
+
+    const auto labels = lengths.labels();
+    auto iet = IntervalExchangeTransformation(std::make_shared<Lengths>(lengths), labels, std::vector<Label>(labels.rbegin(), labels.rend()));
+
+    CountGmpAllocations counter;
+    for (int step = 0; step < 64; step++) {
+      steps++;
+      if (iet.zorichInduction())
+        break;
+    }
+    allocations += counter.allocations();
+  }
+
+  // Most steps do not allocate at all; the quotients of the floor division
+  // and the tracked coefficients account for the remaining allocations.
+  CAPTURE(track, steps, allocations);
+  REQUIRE(allocations < (track ? 2 * steps : steps / 2));
+}
+
+}  // namespace intervalxt::test
@@ -0,0 +1,88 @@
+/**********************************************************************
+ *  This file is part of intervalxt.
+ *
+ *        Copyright (C) 2026 Julian Rüth
+ *
+ *  intervalxt is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  intervalxt is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with intervalxt. If not, see <https://www.gnu.org/licenses/>.
+ *********************************************************************/
+
+#include <type_traits>
+#include <vector>
+
+#include "../src/impl/pooled_list.hpp"
+#include "external/catch2/single_include/catch2/catch.hpp"
+
+namespace intervalxt::test {
+
+TEST_CASE("Pooled Lists", "[pooled_list]") {
+  Pool<int> pool;
+  PooledList<int> list(pool);
+
+  SECTION("Elements are Kept in Order") {
+    list.push_back(1);
+    list.push_back(2);
+    list.push_front(0);
+    REQUIRE(std::vector<int>(list.begin(), list.end()) == std::vector<int>{0, 1, 2});
+    REQUIRE(std::vector<int>(list.rbegin(), list.rend()) == std::vector<int>{2, 1, 0});
+  }
+
+  SECTION("References Survive Insertions") {
+    list.push_back(0);
+    int& front = list.front();
+    const int* address = &front;
+
+    PooledList<int> other(pool);
+    for (int i = 1; i < 1024; i++)
+      other.push_back(i);
+    list.splice(list.end(), other);
+
+    REQUIRE(&list.front() == address);
+    REQUIRE(front == 0);
+    REQUIRE(list.back() == 1023);
+    REQUIRE(list.size() == 1024);
+    REQUIRE(other.empty());
+  }
+
+  SECTION("Iterators of Different Lists Are Different") {
+    PooledList<int> other(pool);
+    REQUIRE(list.begin() == list.end());
+    REQUIRE(list.end() != other.end());
+  }
+
+  SECTION("Moved Lists Take Their Elements") {
+    static_assert(!std::is_copy_constructible_v<PooledList<int>>);
+
+    list.push_back(0);
+    PooledList<int> moved = std::move(list);
+
+    REQUIRE(moved.size() == 1);
+    REQUIRE(list.empty());
+  }
+
+  SECTION("Copies of a Pool Can Grow") {
+    list.push_back(0);
+
+    Pool<int> copy = pool;
+    PooledList<int> copied(copy, list);
+    const int& front = copied.front();
+    for (int i = 1; i < 1024; i++)
+      copied.push_back(i);
+
+    REQUIRE(&copied.front() == &front);
+    REQUIRE(copied.size() == 1024);
+    REQUIRE(list.size() == 1);
+  }
+}
+
+}  // namespace intervalxt::test
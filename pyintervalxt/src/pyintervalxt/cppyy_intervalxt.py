@@ -24,7 +24,6 @@ import cppyy
 from cppyythonizations.pickling.cereal import enable_cereal
 from cppyythonizations.printing import enable_pretty_printing
 from cppyythonizations.util import filtered, wrap_method
-from cppyythonizations.boost.type_erasure import expose
 
 # Importing cysignals after cppyy gives us proper stack traces on segfaults
 # whereas cppyy otherwise only reports "segmentation violation" (which is
@@ -141,21 +140,8 @@ def connections(variants):
 cppyy.py.add_pythonization(filtered("Component")(wrap_method("left")(lambda self, left: connections(left()))), "intervalxt")
 cppyy.py.add_pythonization(filtered("Component")(wrap_method("right")(lambda self, right: connections(right()))), "intervalxt")
 
-# Expose methods on type-erased intervalxt::Lengths.
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("push")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("pop")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("subtract")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("subtractRepeated")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("coefficients")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("cmp")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("similar")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("get")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("render")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("only")), "boost::type_erasure")
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthsInterface,boost::type_erasure::_self>")(expose("forget")), "boost::type_erasure")
-
 # Expose printing on type-erased intervalxt::Length.
-cppyy.py.add_pythonization(filtered("any<intervalxt::LengthInterface,boost::type_erasure::_self>")(enable_pretty_printing), "boost::type_erasure")
+cppyy.py.add_pythonization(filtered("Length")(enable_pretty_printing), "intervalxt")
 
 
 # Set EXTRA_CLING_ARGS="-I /usr/include" or wherever intervalxt/cppyy.hpp can
@@ -178,13 +164,13 @@ def Lengths(lengths, headers=None):
         if type(lengths) == cppyy.gbl.std.vector["int"]:
             headers = ["intervalxt/sample/integer_coefficients.hpp", "intervalxt/sample/integer_floor_division.hpp"]
         elif type(lengths) == cppyy.gbl.std.vector["mpz_class"]:
-            headers = ["intervalxt/sample/mpz_coefficients.hpp", "intervalxt/sample/mpz_floor_division.hpp"]
+            headers = ["intervalxt/sample/mpz_approximation.hpp", "intervalxt/sample/mpz_coefficients.hpp", "intervalxt/sample/mpz_floor_division.hpp"]
         elif type(lengths) == cppyy.gbl.std.vector["mpq_class"]:
-            headers = ["intervalxt/sample/mpq_coefficients.hpp", "intervalxt/sample/mpq_floor_division.hpp"]
+            headers = ["intervalxt/sample/mpq_approximation.hpp", "intervalxt/sample/mpq_coefficients.hpp", "intervalxt/sample/mpq_floor_division.hpp"]
         elif type(lengths) == cppyy.gbl.std.vector["eantic::renf_elem_class"]:
-            headers = ["intervalxt/sample/renf_elem_coefficients.hpp", "intervalxt/sample/renf_elem_floor_division.hpp", "e-antic/cereal.hpp"]
+            headers = ["intervalxt/sample/renf_elem_approximation.hpp", "intervalxt/sample/renf_elem_coefficients.hpp", "intervalxt/sample/renf_elem_floor_division.hpp", "e-antic/cereal.hpp"]
         elif type(lengths) in [cppyy.gbl.std.vector["exactreal::Element<exactreal::IntegerRing>"], cppyy.gbl.std.vector["exactreal::Element<exactreal::RationalField>"], cppyy.gbl.std.vector["exactreal::Element<exactreal::NumberField>"]]:
-            headers = ["intervalxt/sample/element_coefficients.hpp", "intervalxt/sample/element_floor_division.hpp", "exact-real/cereal.hpp"]
+            headers = ["intervalxt/sample/element_approximation.hpp", "intervalxt/sample/element_coefficients.hpp", "intervalxt/sample/element_floor_division.hpp", "exact-real/cereal.hpp"]
         else:
             raise TypeError("unknown length type %s; you need to specify the headers that are needed to unpickle such lengths, i.e., the headers containing floor division and coefficients for that type" % (lengths,))
 